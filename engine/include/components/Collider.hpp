@@ -1,6 +1,7 @@
 #ifndef ENG_ENGINE_COMPONENTS_COLLIDER_HPP
 #define ENG_ENGINE_COMPONENTS_COLLIDER_HPP
 
+#include <cstdint>
 #include <string>
 
 struct Collider {
@@ -13,9 +14,20 @@ struct Collider {
     // Collision layers/tags for filtering
     std::string tag = "default";   // e.g., "player", "enemy", "bullet"
 
+    // Broad-phase filter: a pair is only tested when each mask contains the
+    // other's layer bit. Defaults collide with everything; see
+    // physics/CollisionLayers.hpp to derive both from the tag.
+    std::uint32_t layer = 1u;      // Bit 0, reserved for untagged colliders
+    std::uint32_t mask = 0xFFFFFFFFu;
+
     bool enabled = true;
 };
 
+inline bool LayersInteract(const Collider& a, const Collider& b)
+{
+    return (a.layer & b.mask) != 0 && (b.layer & a.mask) != 0;
+}
+
 struct Hitbox {
     bool visible = false;
     float outlineThickness = 2.0f;
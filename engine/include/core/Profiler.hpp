@@ -16,6 +16,7 @@
 #include <memory>
 #include <deque>
 #include <functional>
+#include <map>
 
 namespace rtype {
 namespace core {
@@ -35,6 +36,8 @@ struct FrameData {
     double fps = 0.0;
     uint64_t entityCount = 0;
     uint64_t drawCalls = 0;
+    uint64_t spritesDrawn = 0;
+    uint64_t spritesCulled = 0;
     size_t memoryUsageBytes = 0;
 };
 
@@ -80,12 +83,20 @@ public:
     void setEntityCount(uint64_t count);
     void addDrawCall();
     void resetDrawCalls();
+    // Sprites sent to the renderer vs skipped as off-screen by the last render pass
+    void setSpriteCounts(uint64_t drawn, uint64_t culled);
     void updateMemoryUsage();
 
     void recordPacketSent(size_t bytes);
     void recordPacketReceived(size_t bytes);
     void updateLatency(double latencyMs);
 
+    // Entity counts per label (tag), computed only when a report asks for them
+    using CensusFunction = std::function<void(std::map<std::string, uint64_t>&)>;
+    void registerEntityCensus(const void* owner, CensusFunction census);
+    void unregisterEntityCensus(const void* owner);
+    std::map<std::string, uint64_t> getEntityCensus() const;
+
     double getCurrentFPS() const;
     double getAverageFPS() const;
     double getFrameTimeMs() const;
@@ -93,6 +104,8 @@ public:
     double getMaxFrameTimeMs() const;
     uint64_t getEntityCount() const;
     uint64_t getDrawCalls() const;
+    uint64_t getSpritesDrawn() const;
+    uint64_t getSpritesCulled() const;
     size_t getMemoryUsageMB() const;
 
     const ProfileSection* getSection(const std::string& name) const;
@@ -140,6 +153,8 @@ private:
     size_t _historySize = 120;
 
     size_t _lastMemoryUsage = 0;
+
+    std::vector<std::pair<const void*, CensusFunction>> _censuses;
 };
 
 #ifdef RTYPE_PROFILING_ENABLED
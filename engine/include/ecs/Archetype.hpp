@@ -0,0 +1,190 @@
+#ifndef ENG_ENGINE_ECS_ARCHETYPE_HPP
+#define ENG_ENGINE_ECS_ARCHETYPE_HPP
+
+#include "Types.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    // Target size of one archetype chunk (all columns of a run of entities)
+    constexpr std::size_t ARCHETYPE_CHUNK_BYTES = 16 * 1024;
+
+    /**
+     * @brief Type-erased operations needed to relocate a component
+     */
+    struct ComponentInfo {
+        std::size_t size = 0;
+        std::size_t align = 0;
+        void (*moveConstruct)(void* dst, void* src) = nullptr;
+        void (*destroy)(void* ptr) = nullptr;
+
+        template<typename T>
+        static ComponentInfo Of()
+        {
+            ComponentInfo info;
+            info.size = sizeof(T);
+            info.align = alignof(T);
+            info.moveConstruct = [](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); };
+            info.destroy = [](void* ptr) { static_cast<T*>(ptr)->~T(); };
+            return info;
+        }
+    };
+
+    /**
+     * @brief All entities sharing one Signature, packed in SoA chunks
+     *
+     * Each chunk holds a power-of-two number of rows: an Entity column
+     * followed by one contiguous column per component type. Rows are
+     * addressed globally (row >> shift = chunk, row & mask = slot) and kept
+     * dense with swap-and-pop, so every chunk but the last is full.
+     */
+    class Archetype {
+     public:
+            static constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-1);
+
+            Archetype(Signature signature, const std::array<ComponentInfo, MAX_COMPONENTS>& infos);
+            ~Archetype();
+
+            Archetype(const Archetype&) = delete;
+            Archetype& operator=(const Archetype&) = delete;
+
+            const Signature& GetSignature() const { return mSignature; }
+            const std::vector<ComponentType>& GetTypes() const { return mTypes; }
+            std::size_t Size() const { return mSize; }
+
+            std::size_t ChunkShift() const { return mChunkShift; }
+            std::size_t ChunkMask() const { return (std::size_t(1) << mChunkShift) - 1; }
+            std::byte* ChunkData(std::size_t chunk) const { return mChunks[chunk]; }
+
+            bool HasColumn(ComponentType type) const { return mColumnOffsets[type] != NO_COLUMN; }
+
+            // Byte offset of a component column inside every chunk (the Entity column is at 0)
+            std::size_t ColumnOffset(ComponentType type) const { return mColumnOffsets[type]; }
+
+            Entity EntityAt(std::size_t row) const
+            {
+                return reinterpret_cast<const Entity*>(mChunks[row >> mChunkShift])[row & ChunkMask()];
+            }
+
+            void* ComponentAt(ComponentType type, std::size_t row) const
+            {
+                return mChunks[row >> mChunkShift] + mColumnOffsets[type] + (row & ChunkMask()) * mInfos[type].size;
+            }
+
+            // Appends a row for the entity; component slots are left unconstructed
+            std::size_t PushRow(Entity entity);
+
+            // Destroys the row's components and fills the hole with the last row.
+            // Returns the entity moved into `row`, or `row`'s own entity if none moved.
+            // The moved entity's component addresses change with it.
+            Entity RemoveRow(std::size_t row);
+
+     private:
+            friend class ArchetypeStorage;
+
+            Signature mSignature;
+            std::vector<ComponentType> mTypes;
+            const std::array<ComponentInfo, MAX_COMPONENTS>& mInfos;
+            std::array<std::size_t, MAX_COMPONENTS> mColumnOffsets;
+
+            std::vector<std::byte*> mChunks;
+            std::size_t mChunkShift = 0;
+            std::size_t mChunkBytes = 0;
+            std::size_t mChunkAlign = alignof(std::max_align_t);
+            std::size_t mSize = 0;
+
+            // Cached neighbours reached by adding/removing one component type
+            std::array<Archetype*, MAX_COMPONENTS> mAddEdges{};
+            std::array<Archetype*, MAX_COMPONENTS> mRemoveEdges{};
+    };
+
+    /**
+     * @brief Archetype-based component storage (StorageMode::Archetype)
+     *
+     * Alternative to the per-type ComponentArrays: an entity's components
+     * live together in the chunk row of the archetype matching its
+     * Signature. Adding or removing a component moves the row to the
+     * neighbouring archetype, which makes structural changes dearer but
+     * turns multi-component views into linear scans of chunk columns.
+     */
+    class ArchetypeStorage {
+     public:
+            template<typename T>
+            void RegisterComponent(ComponentType type)
+            {
+                mInfos[type] = ComponentInfo::Of<T>();
+            }
+
+            template<typename T>
+            void Insert(Entity entity, ComponentType type, T component)
+            {
+                if (Has(entity, type)) {
+                    throw std::runtime_error("Component added to same entity more than once.");
+                }
+
+                Location location = MoveEntity(entity, type, true);
+                new (location.archetype->ComponentAt(type, location.row)) T(std::move(component));
+            }
+
+            void Remove(Entity entity, ComponentType type);
+
+            template<typename T>
+            T& Get(Entity entity, ComponentType type)
+            {
+                void* component = TryGet(entity, type);
+                if (!component) {
+                    throw std::runtime_error("Retrieving non-existent component.");
+                }
+                return *static_cast<T*>(component);
+            }
+
+            void* TryGet(Entity entity, ComponentType type) const
+            {
+                if (entity >= mLocations.size()) {
+                    return nullptr;
+                }
+                const Location& location = mLocations[entity];
+                if (!location.archetype || !location.archetype->HasColumn(type)) {
+                    return nullptr;
+                }
+                return location.archetype->ComponentAt(type, location.row);
+            }
+
+            bool Has(Entity entity, ComponentType type) const
+            {
+                return entity < mLocations.size() && mLocations[entity].archetype
+                    && mLocations[entity].archetype->HasColumn(type);
+            }
+
+            void EntityDestroyed(Entity entity);
+
+            // Archetypes are never destroyed, so indices and pointers stay valid
+            const std::vector<std::unique_ptr<Archetype>>& GetArchetypes() const { return mArchetypes; }
+
+     private:
+            struct Location {
+                Archetype* archetype = nullptr;
+                std::size_t row = 0;
+            };
+
+            // Moves the entity to the archetype with `type` set/cleared; returns its new location
+            Location MoveEntity(Entity entity, ComponentType type, bool adding);
+            Archetype* FindOrCreate(const Signature& signature);
+
+            std::array<ComponentInfo, MAX_COMPONENTS> mInfos{};
+            std::vector<std::unique_ptr<Archetype>> mArchetypes;
+            std::unordered_map<Signature, Archetype*> mArchetypeBySignature;
+            std::array<Archetype*, MAX_COMPONENTS> mRootEdges{};
+            std::vector<Location> mLocations;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_ARCHETYPE_HPP
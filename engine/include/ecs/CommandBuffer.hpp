@@ -0,0 +1,135 @@
+#ifndef ENG_ENGINE_ECS_COMMANDBUFFER_HPP
+#define ENG_ENGINE_ECS_COMMANDBUFFER_HPP
+
+#include "Types.hpp"
+#include "SparseSet.hpp"
+#include "Coordinator.hpp"
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Records structural changes and applies them later in one pass
+     *
+     * Create/add/remove/destroy calls made while systems iterate are
+     * recorded instead of touching the managers. Flush() (the sync point,
+     * chosen by the owner) sorts the commands by entity and applies each
+     * entity's batch with a single signature change, so every system's
+     * membership is updated once per entity instead of once per call.
+     *
+     * - CreateEntity reserves the ID immediately; the entity has no
+     *   components (and belongs to no system) until the flush.
+     * - A destroy wins over every other command recorded for the entity,
+     *   and destroying the same entity twice is coalesced.
+     * - Commands for an entity destroyed directly before the flush are
+     *   dropped, even once its ID was recycled: each command keeps the
+     *   handle (index + generation) the entity had when it was recorded.
+     * - Commands keep their recording order within one entity.
+     */
+    class CommandBuffer {
+     public:
+            explicit CommandBuffer(Coordinator* coordinator = nullptr) : mCoordinator(coordinator) {}
+
+            void SetCoordinator(Coordinator* coordinator) { mCoordinator = coordinator; }
+
+            Entity CreateEntity()
+            {
+                return mCoordinator->CreateEntity();
+            }
+
+            template<typename T>
+            void AddComponent(Entity entity, T component)
+            {
+                Command command = MakeCommand(entity, Kind::Add, mCoordinator->GetComponentType<T>());
+                command.component = std::make_unique<PendingComponent<T>>(std::move(component));
+                mCommands.push_back(std::move(command));
+            }
+
+            template<typename T>
+            void RemoveComponent(Entity entity)
+            {
+                Command command = MakeCommand(entity, Kind::Remove, mCoordinator->GetComponentType<T>());
+                command.remove = [](ComponentManager& components, Entity target) {
+                    components.RemoveComponent<T>(target);
+                };
+                mCommands.push_back(std::move(command));
+            }
+
+            void DestroyEntity(Entity entity)
+            {
+                if (mPendingDestroys.Contains(entity)) {
+                    return;
+                }
+                mPendingDestroys.Insert(entity);
+                mCommands.push_back(MakeCommand(entity, Kind::Destroy, 0));
+            }
+
+            // True once DestroyEntity was recorded for the entity in this batch
+            bool IsDestroyQueued(Entity entity) const { return mPendingDestroys.Contains(entity); }
+
+            std::size_t Size() const { return mCommands.size(); }
+            bool Empty() const { return mCommands.empty(); }
+
+            // Applies and clears every recorded command
+            void Flush();
+
+            // Drops every recorded command (reserved entities stay alive)
+            void Clear()
+            {
+                mCommands.clear();
+                mPendingDestroys.Clear();
+            }
+
+     private:
+            enum class Kind : std::uint8_t { Add, Remove, Destroy };
+
+            struct IPendingComponent {
+                virtual ~IPendingComponent() = default;
+                virtual void AddTo(ComponentManager& components, Entity entity) = 0;
+            };
+
+            template<typename T>
+            struct PendingComponent : IPendingComponent {
+                explicit PendingComponent(T value) : component(std::move(value)) {}
+
+                void AddTo(ComponentManager& components, Entity entity) override
+                {
+                    components.AddComponent<T>(entity, std::move(component));
+                }
+
+                T component;
+            };
+
+            struct Command {
+                EntityHandle handle;  // Null when the entity was already dead
+                Kind kind = Kind::Add;
+                ComponentType type = 0;
+                std::unique_ptr<IPendingComponent> component;
+                void (*remove)(ComponentManager&, Entity) = nullptr;
+            };
+
+            Command MakeCommand(Entity entity, Kind kind, ComponentType type) const
+            {
+                Command command;
+                if (mCoordinator->IsAlive(entity)) {
+                    command.handle = mCoordinator->GetHandle(entity);
+                }
+                command.kind = kind;
+                command.type = type;
+                return command;
+            }
+
+            // Applies the commands of one entity; `first`/`last` bound its run
+            void ApplyRun(std::vector<Command>::iterator first, std::vector<Command>::iterator last);
+
+            Coordinator* mCoordinator = nullptr;
+            std::vector<Command> mCommands;
+            SparseSet mPendingDestroys;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_COMMANDBUFFER_HPP
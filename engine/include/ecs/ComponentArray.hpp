@@ -2,10 +2,14 @@
 #define ENG_ENGINE_ECS_COMPONENTARRAY_HPP
 
 #include "Types.hpp"
-#include <array>
-#include <unordered_map>
+#include "SparseSet.hpp"
 #include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace ECS {
 
@@ -15,76 +19,117 @@ namespace ECS {
             virtual void EntityDestroyed(Entity entity) = 0;
     };
 
+    /**
+     * @brief Packed storage for one component type
+     *
+     * Backed by a SparseSet: components live in a dense array parallel to
+     * the set's dense entity array, so lookups are a page index plus an
+     * array read, and systems can walk Entities()/At() linearly.
+     *
+     * The dense array is split into fixed-size pages that never move, so a
+     * T& stays valid while more components of the same type are added.
+     * Removing a component still moves the last one into its slot.
+     */
     template<typename T>
     class ComponentArray : public IComponentArray {
      public:
+            static constexpr std::size_t PAGE_SIZE = 1024;
+
+            ComponentArray() = default;
+            ComponentArray(const ComponentArray&) = delete;
+            ComponentArray& operator=(const ComponentArray&) = delete;
+
+            ~ComponentArray() override
+            {
+                for (std::size_t i = 0; i < mSize; ++i) {
+                    Slot(i)->~T();
+                }
+            }
+
             void InsertData(Entity entity, T component)
             {
-                if (mEntityToIndexMap.find(entity) != mEntityToIndexMap.end()) {
+                if (mEntitySet.Contains(entity)) {
                     throw std::runtime_error("Component added to same entity more than once.");
                 }
 
-                // Put new entry at end and update the maps
-                size_t newIndex = mSize;
-                mEntityToIndexMap[entity] = newIndex;
-                mIndexToEntityMap[newIndex] = entity;
-                mComponentArray[newIndex] = component;
+                // Put new entry at end, index and data stay parallel
+                if (mSize == mPages.size() * PAGE_SIZE) {
+                    mPages.push_back(std::make_unique<Page>());
+                }
+                new (Slot(mSize)) T(std::move(component));
                 ++mSize;
+                mEntitySet.Insert(entity);
             }
 
             void RemoveData(Entity entity)
             {
-                if (mEntityToIndexMap.find(entity) == mEntityToIndexMap.end()) {
+                if (!mEntitySet.Contains(entity)) {
                     throw std::runtime_error("Removing non-existent component.");
                 }
 
-                // Copy element at end into deleted element's place to maintain density
-                size_t indexOfRemovedEntity = mEntityToIndexMap[entity];
-                size_t indexOfLastElement = mSize - 1;
-                mComponentArray[indexOfRemovedEntity] = mComponentArray[indexOfLastElement];
-
-                // Update map to point to moved spot
-                Entity entityOfLastElement = mIndexToEntityMap[indexOfLastElement];
-                mEntityToIndexMap[entityOfLastElement] = indexOfRemovedEntity;
-                mIndexToEntityMap[indexOfRemovedEntity] = entityOfLastElement;
-
-                // Remove the entity's entry from the maps
-                mEntityToIndexMap.erase(entity);
-                mIndexToEntityMap.erase(indexOfLastElement);
-
+                // Move element at end into deleted element's place to maintain density
+                std::size_t indexOfRemovedEntity = mEntitySet.Remove(entity);
+                std::size_t indexOfLastElement = mSize - 1;
+                if (indexOfRemovedEntity != indexOfLastElement) {
+                    *Slot(indexOfRemovedEntity) = std::move(*Slot(indexOfLastElement));
+                }
+                Slot(indexOfLastElement)->~T();
                 --mSize;
             }
 
             T& GetData(Entity entity)
             {
-                if (mEntityToIndexMap.find(entity) == mEntityToIndexMap.end()) {
+                std::size_t index = mEntitySet.IndexOf(entity);
+                if (index == SparseSet::INVALID_INDEX) {
                     throw std::runtime_error("Retrieving non-existent component.");
                 }
 
                 // Return a reference to the entity's component
-                return mComponentArray[mEntityToIndexMap[entity]];
+                return *Slot(index);
+            }
+
+            // Returns nullptr instead of throwing when the entity has no component
+            T* TryGetData(Entity entity)
+            {
+                std::size_t index = mEntitySet.IndexOf(entity);
+                return index == SparseSet::INVALID_INDEX ? nullptr : Slot(index);
             }
 
             void EntityDestroyed(Entity entity) override
             {
-                if (mEntityToIndexMap.find(entity) != mEntityToIndexMap.end()) {
+                if (mEntitySet.Contains(entity)) {
                     // Remove the entity's component if it existed
                     RemoveData(entity);
                 }
             }
 
-            size_t Size() const { return mSize; }
+            std::size_t Size() const { return mSize; }
 
             bool HasData(Entity entity) const
             {
-                return mEntityToIndexMap.find(entity) != mEntityToIndexMap.end();
+                return mEntitySet.Contains(entity);
             }
 
+            // Dense iteration: Entities()[i] owns At(i) for i < Size()
+            const std::vector<Entity>& Entities() const { return mEntitySet.Dense(); }
+            T& At(std::size_t index) { return *Slot(index); }
+            const T& At(std::size_t index) const { return *Slot(index); }
+
      private:
-            std::array<T, MAX_ENTITIES> mComponentArray;
-            std::unordered_map<Entity, size_t> mEntityToIndexMap;
-            std::unordered_map<size_t, Entity> mIndexToEntityMap;
-            size_t mSize = 0;
+            // Raw storage, components are constructed in place on insert
+            struct Page {
+                alignas(T) unsigned char bytes[sizeof(T) * PAGE_SIZE];
+            };
+
+            T* Slot(std::size_t index) const
+            {
+                unsigned char* bytes = mPages[index / PAGE_SIZE]->bytes + (index % PAGE_SIZE) * sizeof(T);
+                return std::launder(reinterpret_cast<T*>(bytes));
+            }
+
+            SparseSet mEntitySet;
+            std::vector<std::unique_ptr<Page>> mPages;
+            std::size_t mSize = 0;
     };
 
 } // namespace ECS
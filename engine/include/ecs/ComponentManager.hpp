@@ -2,85 +2,128 @@
 #define ENG_ENGINE_ECS_COMPONENTMANAGER_HPP
 
 #include "Types.hpp"
+#include "TypeId.hpp"
 #include "ComponentArray.hpp"
+#include "Archetype.hpp"
+#include <array>
 #include <memory>
-#include <unordered_map>
-#include <typeinfo>
 #include <stdexcept>
-#include <string>
+#include <utility>
 
 namespace ECS {
 
+    /**
+     * @brief Owns one ComponentArray per registered component type
+     *
+     * Arrays live in a flat table indexed by ComponentType. A component's
+     * ComponentType is found from its compile-time TypeHash, so an access
+     * costs a fixed-size table probe plus an array index instead of building
+     * and hashing a type name string.
+     *
+     * In StorageMode::Archetype the same API is served by an
+     * ArchetypeStorage instead and the ComponentArrays stay empty.
+     */
     class ComponentManager {
      public:
+            explicit ComponentManager(StorageMode mode = StorageMode::SparseSet)
+            {
+                if (mode == StorageMode::Archetype) {
+                    mArchetypes = std::make_unique<ArchetypeStorage>();
+                }
+            }
+
             template<typename T>
             void RegisterComponent()
             {
-                std::string typeName = typeid(T).name();
+                if (mNextComponentType >= MAX_COMPONENTS) {
+                    throw std::runtime_error("Too many component types registered.");
+                }
 
-                if (mComponentTypes.find(typeName) != mComponentTypes.end()) {
+                if (!mComponentTypes.Insert(TypeHashOf<T>(), mNextComponentType)) {
                     throw std::runtime_error("Registering component type more than once.");
                 }
 
-                mComponentTypes.insert({typeName, mNextComponentType});
-                mComponentArrays.insert({typeName, std::make_shared<ComponentArray<T>>()});
+                mComponentArrays[mNextComponentType] = std::make_unique<ComponentArray<T>>();
+                if (mArchetypes) {
+                    mArchetypes->RegisterComponent<T>(mNextComponentType);
+                }
                 ++mNextComponentType;
             }
 
             template<typename T>
-            ComponentType GetComponentType()
+            ComponentType GetComponentType() const
             {
-                std::string typeName = typeid(T).name();
+                std::uint32_t type = mComponentTypes.Find(TypeHashOf<T>());
 
-                if (mComponentTypes.find(typeName) == mComponentTypes.end()) {
+                if (type == TypeIndexMap<COMPONENT_TYPE_SLOTS>::NOT_FOUND) {
                     throw std::runtime_error("Component not registered before use.");
                 }
 
-                return mComponentTypes[typeName];
+                return static_cast<ComponentType>(type);
             }
 
             template<typename T>
             void AddComponent(Entity entity, T component)
             {
-                GetComponentArray<T>()->InsertData(entity, component);
+                if (mArchetypes) {
+                    mArchetypes->Insert(entity, GetComponentType<T>(), std::move(component));
+                    return;
+                }
+                GetComponentArray<T>()->InsertData(entity, std::move(component));
             }
 
             template<typename T>
             void RemoveComponent(Entity entity)
             {
+                if (mArchetypes) {
+                    mArchetypes->Remove(entity, GetComponentType<T>());
+                    return;
+                }
                 GetComponentArray<T>()->RemoveData(entity);
             }
 
             template<typename T>
             T& GetComponent(Entity entity)
             {
+                if (mArchetypes) {
+                    return mArchetypes->Get<T>(entity, GetComponentType<T>());
+                }
                 return GetComponentArray<T>()->GetData(entity);
             }
 
             template<typename T>
             bool HasComponent(Entity entity)
             {
+                if (mArchetypes) {
+                    return mArchetypes->Has(entity, GetComponentType<T>());
+                }
                 return GetComponentArray<T>()->HasData(entity);
             }
 
             void EntityDestroyed(Entity entity);
 
-     private:
-            std::unordered_map<std::string, ComponentType> mComponentTypes;
-            std::unordered_map<std::string, std::shared_ptr<IComponentArray>> mComponentArrays;
-            ComponentType mNextComponentType = 0;
+            StorageMode GetStorageMode() const
+            {
+                return mArchetypes ? StorageMode::Archetype : StorageMode::SparseSet;
+            }
+
+            // nullptr unless running in StorageMode::Archetype
+            ArchetypeStorage* GetArchetypeStorage() { return mArchetypes.get(); }
 
             template<typename T>
-            std::shared_ptr<ComponentArray<T>> GetComponentArray()
+            ComponentArray<T>* GetComponentArray()
             {
-                std::string typeName = typeid(T).name();
+                return static_cast<ComponentArray<T>*>(mComponentArrays[GetComponentType<T>()].get());
+            }
 
-                if (mComponentTypes.find(typeName) == mComponentTypes.end()) {
-                    throw std::runtime_error("Component not registered before use.");
-                }
+     private:
+            // Probe table slots, kept at twice the type count for short probes
+            static constexpr std::size_t COMPONENT_TYPE_SLOTS = MAX_COMPONENTS * 2;
 
-                return std::static_pointer_cast<ComponentArray<T>>(mComponentArrays[typeName]);
-            }
+            TypeIndexMap<COMPONENT_TYPE_SLOTS> mComponentTypes;
+            std::array<std::unique_ptr<IComponentArray>, MAX_COMPONENTS> mComponentArrays;
+            ComponentType mNextComponentType = 0;
+            std::unique_ptr<ArchetypeStorage> mArchetypes;
     };
 
 } // namespace ECS
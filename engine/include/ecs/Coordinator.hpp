@@ -5,20 +5,38 @@
 #include "EntityManager.hpp"
 #include "ComponentManager.hpp"
 #include "SystemManager.hpp"
+#include "View.hpp"
 #include <memory>
 
 namespace ECS
 {
 
+    class CommandBuffer;
+
     class Coordinator {
         public:
-            void Init();
+            void Init(StorageMode mode = StorageMode::SparseSet, Entity maxEntities = DEFAULT_MAX_ENTITIES);
             void RegisterDefaultComponents();
             void Shutdown();
 
             Entity CreateEntity();
+            // Destroying an entity that is not alive is a no-op
             void DestroyEntity(Entity entity);
 
+            /**
+             * @brief Generational handles for references kept across frames
+             *
+             * A cached raw Entity may silently point at a recycled slot; a
+             * handle taken with GetHandle (or CreateHandle) stops being alive
+             * as soon as its entity is destroyed.
+             */
+            EntityHandle CreateHandle();
+            EntityHandle GetHandle(Entity entity) const;
+            bool IsAlive(Entity entity) const;
+            bool IsAlive(EntityHandle handle) const;
+            // Returns false (and does nothing) for a stale or null handle
+            bool DestroyEntity(EntityHandle handle);
+
             template <typename T>
             void RegisterComponent()
             {
@@ -30,11 +48,12 @@ namespace ECS
             {
                 mComponentManager->AddComponent<T>(entity, component);
 
-                auto signature = mEntityManager->GetSignature(entity);
+                const auto oldSignature = mEntityManager->GetSignature(entity);
+                auto signature = oldSignature;
                 signature.set(mComponentManager->GetComponentType<T>(), true);
                 mEntityManager->SetSignature(entity, signature);
 
-                mSystemManager->EntitySignatureChanged(entity, signature);
+                mSystemManager->EntitySignatureChanged(entity, oldSignature, signature);
             }
 
             template <typename T>
@@ -42,11 +61,12 @@ namespace ECS
             {
                 mComponentManager->RemoveComponent<T>(entity);
 
-                auto signature = mEntityManager->GetSignature(entity);
+                const auto oldSignature = mEntityManager->GetSignature(entity);
+                auto signature = oldSignature;
                 signature.set(mComponentManager->GetComponentType<T>(), false);
                 mEntityManager->SetSignature(entity, signature);
 
-                mSystemManager->EntitySignatureChanged(entity, signature);
+                mSystemManager->EntitySignatureChanged(entity, oldSignature, signature);
             }
 
             template <typename T>
@@ -61,6 +81,19 @@ namespace ECS
                 return mComponentManager->HasComponent<T>(entity);
             }
 
+            /**
+             * @brief Query every entity owning all of Ts...
+             * @see ECS::View for iteration rules
+             */
+            template <typename... Ts>
+            ECS::View<Ts...> View()
+            {
+                if (ArchetypeStorage* archetypes = mComponentManager->GetArchetypeStorage()) {
+                    return ECS::View<Ts...>(archetypes, {mComponentManager->GetComponentType<Ts>()...});
+                }
+                return ECS::View<Ts...>(mComponentManager->GetComponentArray<Ts>()...);
+            }
+
             template <typename T>
             ComponentType GetComponentType()
             {
@@ -82,6 +115,10 @@ namespace ECS
             Signature GetEntitySignature(Entity entity) const;
             std::uint32_t GetLivingEntityCount() const;
 
+            // Runtime cap on living entities (CreateEntity throws beyond it)
+            void SetMaxEntities(Entity maxEntities);
+            Entity GetMaxEntities() const;
+
             void SetNetworkId(Entity entity, NetworkId networkId);
             NetworkId GetNetworkId(Entity entity) const;
             bool HasNetworkId(Entity entity) const;
@@ -89,6 +126,9 @@ namespace ECS
             bool HasEntityForNetworkId(NetworkId networkId) const;
 
         private:
+            // Applies batched component changes with one signature update per entity
+            friend class CommandBuffer;
+
             std::unique_ptr<ComponentManager> mComponentManager;
             std::unique_ptr<EntityManager> mEntityManager;
             std::unique_ptr<SystemManager> mSystemManager;
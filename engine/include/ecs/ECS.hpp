@@ -3,10 +3,14 @@
 
 #include "Types.hpp"
 #include "EntityManager.hpp"
+#include "TypeId.hpp"
+#include "SparseSet.hpp"
 #include "ComponentArray.hpp"
 #include "ComponentManager.hpp"
 #include "System.hpp"
 #include "SystemManager.hpp"
+#include "View.hpp"
 #include "Coordinator.hpp"
+#include "CommandBuffer.hpp"
 
 #endif // ENG_ENGINE_ECS_ECS_HPP
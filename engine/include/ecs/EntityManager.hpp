@@ -2,22 +2,44 @@
 #define ENG_ENGINE_ECS_ENTITYMANAGER_HPP
 
 #include "Types.hpp"
+#include "PagePool.hpp"
 #include <array>
 #include <queue>
 #include <cassert>
 #include <unordered_map>
+#include <vector>
 
 namespace ECS {
 
+    /**
+     * @brief Hands out entity IDs and keeps their per-entity records
+     *
+     * IDs are issued from a counter and recycled through a FIFO queue once
+     * MIN_FREE_ENTITIES are waiting. Signatures, versions and liveness live
+     * in pages of SPARSE_PAGE_SIZE records taken from the shared PagePool as
+     * the counter reaches them, so memory follows the highest ID in use
+     * rather than a compile-time maximum.
+     */
     class EntityManager {
      public:
-            EntityManager();
+            explicit EntityManager(Entity maxEntities = DEFAULT_MAX_ENTITIES);
             Entity CreateEntity();
             void DestroyEntity(Entity entity);
             void SetSignature(Entity entity, Signature signature);
             Signature GetSignature(Entity entity) const;
             std::uint32_t GetLivingEntityCount() const;
 
+            // Cap on living entities; may be changed at any time but not below the living count
+            void SetMaxEntities(Entity maxEntities);
+            Entity GetMaxEntities() const { return mMaxEntities; }
+            // One past the highest ID ever issued (size of per-entity tables)
+            Entity GetEntityRange() const { return mNextEntity; }
+
+            // Generation tracking: O(1) checks against the per-slot version
+            bool IsAlive(Entity entity) const;
+            bool IsAlive(EntityHandle handle) const;
+            EntityHandle GetHandle(Entity entity) const;
+
             void SetNetworkId(Entity entity, NetworkId networkId);
             NetworkId GetNetworkId(Entity entity) const;
             bool HasNetworkId(Entity entity) const;
@@ -25,8 +47,21 @@ namespace ECS {
             bool HasEntityForNetworkId(NetworkId networkId) const;
 
      private:
+            struct Record {
+                Signature signature;
+                std::uint32_t version;
+                bool alive;
+            };
+            using Page = std::array<Record, SPARSE_PAGE_SIZE>;
+            using Pool = PagePool<Page>;
+
+            Record& At(Entity entity) { return (*mPages[entity / SPARSE_PAGE_SIZE])[entity % SPARSE_PAGE_SIZE]; }
+            const Record& At(Entity entity) const { return (*mPages[entity / SPARSE_PAGE_SIZE])[entity % SPARSE_PAGE_SIZE]; }
+
             std::queue<Entity> mAvailableEntities;
-            std::array<Signature, MAX_ENTITIES> mSignatures;
+            std::vector<Pool::Pointer> mPages;
+            Entity mNextEntity = 0;
+            Entity mMaxEntities;
             std::uint32_t mLivingEntityCount;
             
             std::unordered_map<Entity, NetworkId> mEntityToNetworkId;
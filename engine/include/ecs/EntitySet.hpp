@@ -0,0 +1,127 @@
+#ifndef ENG_ENGINE_ECS_ENTITYSET_HPP
+#define ENG_ENGINE_ECS_ENTITYSET_HPP
+
+#include "Types.hpp"
+#include "SparseSet.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Dense membership list of a System
+     *
+     * Replaces the former std::set<Entity>: insert/erase are O(1)
+     * sparse-set operations (and no-ops on duplicates / missing entities)
+     * and entities are stored contiguously. Erase is swap-and-pop, so
+     * iteration follows the dense array, not entity order; a system that
+     * needs a stable order (CollisionSystem's pairs, UI draw order) sorts
+     * what it gathered itself.
+     *
+     * Iterators hold an index instead of a pointer, so inserting or erasing
+     * while a system walks its own list never dereferences freed memory
+     * (entities swapped around by an erase may be skipped or seen twice,
+     * like erasing from a vector being walked).
+     */
+    class EntitySet {
+     public:
+            class Iterator {
+             public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = Entity;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const Entity*;
+                    using reference = Entity;
+
+                    Iterator() = default;
+                    Iterator(const EntitySet* set, std::size_t index) : mSet(set), mIndex(index) {}
+
+                    Entity operator*() const { return mSet->mEntities[mIndex]; }
+
+                    Iterator& operator++()
+                    {
+                        ++mIndex;
+                        return *this;
+                    }
+
+                    Iterator operator++(int)
+                    {
+                        Iterator previous = *this;
+                        ++mIndex;
+                        return previous;
+                    }
+
+                    // Any position past the current size compares equal to end()
+                    bool operator==(const Iterator& other) const
+                    {
+                        return Clamped() == other.Clamped();
+                    }
+
+                    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+             private:
+                    std::size_t Clamped() const
+                    {
+                        const std::size_t size = mSet ? mSet->mEntities.Size() : 0;
+                        return mIndex < size ? mIndex : size;
+                    }
+
+                    const EntitySet* mSet = nullptr;
+                    std::size_t mIndex = 0;
+            };
+
+            using iterator = Iterator;
+            using const_iterator = Iterator;
+
+            void insert(Entity entity)
+            {
+                if (mEntities.Contains(entity)) {
+                    return;
+                }
+                mEntities.Insert(entity);
+                ++mVersion;
+            }
+
+            // Returns the number of entities removed (0 or 1), like std::set
+            std::size_t erase(Entity entity)
+            {
+                if (!mEntities.Contains(entity)) {
+                    return 0;
+                }
+                mEntities.Remove(entity);
+                ++mVersion;
+                return 1;
+            }
+
+            bool contains(Entity entity) const { return mEntities.Contains(entity); }
+            std::size_t count(Entity entity) const { return contains(entity) ? 1 : 0; }
+
+            void clear()
+            {
+                mEntities.Clear();
+                ++mVersion;
+            }
+
+            std::size_t size() const { return mEntities.Size(); }
+            bool empty() const { return mEntities.Empty(); }
+
+            // Bumped by every membership change: systems caching per-member data compare it between frames
+            std::uint64_t Version() const { return mVersion; }
+
+            // Contiguous view of the members, in dense (not entity) order
+            const std::vector<Entity>& Dense() const { return mEntities.Dense(); }
+
+            Iterator begin() const { return Iterator(this, 0); }
+
+            Iterator end() const { return Iterator(this, mEntities.Size()); }
+
+     private:
+            SparseSet mEntities;
+            std::uint64_t mVersion = 0;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_ENTITYSET_HPP
@@ -0,0 +1,91 @@
+#ifndef ENG_ENGINE_ECS_PAGEPOOL_HPP
+#define ENG_ENGINE_ECS_PAGEPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Process-wide recycler of fixed-size storage pages
+     *
+     * Sparse sets and the EntityManager grow in pages of SPARSE_PAGE_SIZE
+     * slots. Pages released by one container (a bullet-only component whose
+     * ID range emptied, a coordinator being reset) are kept here and handed
+     * to the next container that needs one, instead of going back to the
+     * heap and being allocated again a few frames later.
+     *
+     * Acquire/Release lock a mutex; they only run when a page is first
+     * touched or emptied, never on component lookups.
+     */
+    template<typename Page>
+    class PagePool {
+     public:
+            // Returns the page to the shared pool instead of deleting it
+            struct Deleter {
+                void operator()(Page* page) const { Shared().Release(page); }
+            };
+            using Pointer = std::unique_ptr<Page, Deleter>;
+
+            // Intentionally leaked so containers destroyed during static teardown can still release
+            static PagePool& Shared()
+            {
+                static PagePool* pool = new PagePool();
+                return *pool;
+            }
+
+            // Contents are unspecified: recycled pages keep their previous data
+            Pointer Acquire()
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                ++mInUse;
+                if (mFree.empty()) {
+                    return Pointer(new Page());
+                }
+                Page* page = mFree.back().release();
+                mFree.pop_back();
+                return Pointer(page);
+            }
+
+            // Frees every cached page (memory held by live containers is untouched)
+            void Trim()
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mFree.clear();
+            }
+
+            std::size_t InUse() const
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mInUse;
+            }
+
+            std::size_t Cached() const
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mFree.size();
+            }
+
+     private:
+            PagePool() = default;
+
+            void Release(Page* page)
+            {
+                if (!page) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(mMutex);
+                --mInUse;
+                mFree.emplace_back(page);
+            }
+
+            mutable std::mutex mMutex;
+            std::vector<std::unique_ptr<Page>> mFree;
+            std::size_t mInUse = 0;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_PAGEPOOL_HPP
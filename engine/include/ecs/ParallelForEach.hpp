@@ -0,0 +1,102 @@
+#ifndef ENG_ENGINE_ECS_PARALLELFOREACH_HPP
+#define ENG_ENGINE_ECS_PARALLELFOREACH_HPP
+
+#include "Types.hpp"
+#include "View.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Tuning of ParallelForEach / ParallelCollect
+     */
+    struct ParallelOptions {
+        // Below this many candidate entities everything runs serially on the caller
+        std::size_t minEntities = 2048;
+        // Candidate entities handed to one task
+        std::size_t chunkSize = 512;
+    };
+
+    namespace detail {
+
+        // Splits [0, count) into chunkSize ranges; body(chunk, first, last) runs on the pool
+        template<typename Body>
+        void RunChunks(ThreadPool* pool, std::size_t count, const ParallelOptions& options, Body& body)
+        {
+            const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+            const std::size_t chunks = (count + chunkSize - 1) / chunkSize;
+
+            if (!pool || pool->WorkerCount() == 0 || count < options.minEntities || chunks < 2) {
+                for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                    body(chunk, chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+                }
+                return;
+            }
+
+            TaskGroup group;
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                pool->Submit(group, [&body, chunk, chunkSize, count]() {
+                    body(chunk, chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+                });
+            }
+            pool->Wait(group);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief View::Each split in chunks of the view's dense storage across a pool
+     *
+     * func(Entity, Ts&...) is called concurrently from several threads, each
+     * chunk covering distinct entities, so it may freely write the viewed
+     * components of the entity it is given but nothing shared (and must not
+     * change entity structure). Results therefore do not depend on the
+     * number of workers. Small views run serially.
+     */
+    template<typename... Ts, typename Func>
+    void ParallelForEach(ThreadPool* pool, const View<Ts...>& view, Func&& func,
+        const ParallelOptions& options = ParallelOptions{})
+    {
+        auto body = [&view, &func](std::size_t, std::size_t first, std::size_t last) {
+            view.EachInRange(first, last, func);
+        };
+        detail::RunChunks(pool, view.SizeHint(), options, body);
+    }
+
+    /**
+     * @brief ParallelForEach returning the entities for which pred returned true
+     *
+     * Each chunk gathers its own matches; they are concatenated in chunk
+     * order, so the result is the same whether the pool has workers or not.
+     * Typical use is collecting entities to destroy after the parallel pass.
+     */
+    template<typename... Ts, typename Pred>
+    std::vector<Entity> ParallelCollect(ThreadPool* pool, const View<Ts...>& view, Pred&& pred,
+        const ParallelOptions& options = ParallelOptions{})
+    {
+        const std::size_t count = view.SizeHint();
+        const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+        std::vector<std::vector<Entity>> matches((count + chunkSize - 1) / chunkSize);
+
+        auto body = [&view, &pred, &matches](std::size_t chunk, std::size_t first, std::size_t last) {
+            view.EachInRange(first, last, [&pred, &found = matches[chunk]](Entity entity, Ts&... components) {
+                if (pred(entity, components...)) {
+                    found.push_back(entity);
+                }
+            });
+        };
+        detail::RunChunks(pool, count, options, body);
+
+        std::vector<Entity> result;
+        for (auto& found : matches) {
+            result.insert(result.end(), found.begin(), found.end());
+        }
+        return result;
+    }
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_PARALLELFOREACH_HPP
@@ -0,0 +1,121 @@
+#ifndef ENG_ENGINE_ECS_SPARSESET_HPP
+#define ENG_ENGINE_ECS_SPARSESET_HPP
+
+#include "Types.hpp"
+#include "PagePool.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Paged sparse set of entities
+     *
+     * Maps an entity to a slot in a packed (dense) entity array:
+     * - the sparse side is split in fixed-size pages taken from the shared
+     *   PagePool on first use and given back once their last entity leaves,
+     *   so memory follows the entity IDs actually in the set
+     * - the dense side keeps entities contiguous for iteration
+     *
+     * Lookup, insertion and removal are O(1) and never hash. Removal is
+     * swap-and-pop: the last dense entity moves into the freed slot, which
+     * callers storing parallel data (ComponentArray) must mirror.
+     */
+    class SparseSet {
+     public:
+            static constexpr std::size_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+            bool Contains(Entity entity) const
+            {
+                return IndexOf(entity) != INVALID_INDEX;
+            }
+
+            // Dense index of the entity, or INVALID_INDEX if absent
+            std::size_t IndexOf(Entity entity) const
+            {
+                const std::size_t page = entity / SPARSE_PAGE_SIZE;
+                if (page >= mSparsePages.size() || !mSparsePages[page]) {
+                    return INVALID_INDEX;
+                }
+                return mSparsePages[page]->slots[entity % SPARSE_PAGE_SIZE];
+            }
+
+            // Append the entity to the dense array and return its index
+            std::size_t Insert(Entity entity)
+            {
+                const std::size_t index = mDense.size();
+                SparseSlot(entity) = static_cast<std::uint32_t>(index);
+                ++mSparsePages[entity / SPARSE_PAGE_SIZE]->used;
+                mDense.push_back(entity);
+                return index;
+            }
+
+            // Swap-and-pop the entity out; returns the dense index it occupied
+            std::size_t Remove(Entity entity)
+            {
+                const std::size_t index = IndexOf(entity);
+                const std::size_t last = mDense.size() - 1;
+
+                if (index != last) {
+                    const Entity moved = mDense[last];
+                    mDense[index] = moved;
+                    SparseSlot(moved) = static_cast<std::uint32_t>(index);
+                }
+
+                SparseSlot(entity) = static_cast<std::uint32_t>(INVALID_INDEX);
+                mDense.pop_back();
+
+                // Hand an emptied page back to the pool
+                auto& page = mSparsePages[entity / SPARSE_PAGE_SIZE];
+                if (--page->used == 0) {
+                    page.reset();
+                }
+                return index;
+            }
+
+            void Clear()
+            {
+                mSparsePages.clear();
+                mDense.clear();
+            }
+
+            std::size_t Size() const { return mDense.size(); }
+            bool Empty() const { return mDense.empty(); }
+
+            const std::vector<Entity>& Dense() const { return mDense; }
+            Entity operator[](std::size_t index) const { return mDense[index]; }
+
+            std::vector<Entity>::const_iterator begin() const { return mDense.begin(); }
+            std::vector<Entity>::const_iterator end() const { return mDense.end(); }
+
+     private:
+            struct Page {
+                std::array<std::uint32_t, SPARSE_PAGE_SIZE> slots;
+                std::uint32_t used;  // Entities of the set mapped by this page
+            };
+            using Pool = PagePool<Page>;
+
+            std::uint32_t& SparseSlot(Entity entity)
+            {
+                const std::size_t page = entity / SPARSE_PAGE_SIZE;
+                if (page >= mSparsePages.size()) {
+                    mSparsePages.resize(page + 1);
+                }
+                if (!mSparsePages[page]) {
+                    mSparsePages[page] = Pool::Shared().Acquire();
+                    mSparsePages[page]->slots.fill(static_cast<std::uint32_t>(INVALID_INDEX));
+                    mSparsePages[page]->used = 0;
+                }
+                return mSparsePages[page]->slots[entity % SPARSE_PAGE_SIZE];
+            }
+
+            std::vector<Pool::Pointer> mSparsePages;
+            std::vector<Entity> mDense;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_SPARSESET_HPP
@@ -2,7 +2,7 @@
 #define ENG_ENGINE_ECS_SYSTEM_HPP
 
 #include "Types.hpp"
-#include <set>
+#include "EntitySet.hpp"
 
 namespace ECS {
 
@@ -14,13 +14,45 @@ namespace ECS {
             virtual void Shutdown() = 0;
             
             // Helper methods for manual entity management (for dynamically loaded systems)
-            virtual void AddEntityToSystem(Entity entity) { mEntities.insert(entity); }
-            virtual void RemoveEntityFromSystem(Entity entity) { mEntities.erase(entity); }
+            virtual void AddEntityToSystem(Entity entity) { Join(entity); }
+            virtual void RemoveEntityFromSystem(Entity entity) { Leave(entity); }
             virtual size_t GetEntityCount() const { return mEntities.size(); }
 
+            // Applies structural changes recorded during Update. Called serially
+            // by a SystemScheduler once the system's concurrent update is over.
+            virtual void ApplyDeferred() {}
+
      protected:
-            std::set<Entity> mEntities;
+            // True while a SystemScheduler runs this system (possibly on a worker
+            // thread); unscheduled systems apply their deferred changes themselves
+            bool IsScheduled() const { return mScheduled; }
+
+            // Called right after an entity joins or leaves mEntities, for systems
+            // keeping per-member data up to date one entity at a time
+            virtual void OnEntityAdded(Entity) {}
+            virtual void OnEntityRemoved(Entity) {}
+
+            EntitySet mEntities;
             friend class SystemManager;
+            friend class SystemScheduler;
+
+     private:
+            void Join(Entity entity)
+            {
+                if (!mEntities.contains(entity)) {
+                    mEntities.insert(entity);
+                    OnEntityAdded(entity);
+                }
+            }
+
+            void Leave(Entity entity)
+            {
+                if (mEntities.erase(entity) != 0) {
+                    OnEntityRemoved(entity);
+                }
+            }
+
+            bool mScheduled = false;
     };
 
 } // namespace ECS
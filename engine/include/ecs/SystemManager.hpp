@@ -2,11 +2,13 @@
 #define ENG_ENGINE_ECS_SYSTEMMANAGER_HPP
 
 #include "Types.hpp"
+#include "TypeId.hpp"
 #include "System.hpp"
+#include <array>
 #include <memory>
 #include <unordered_map>
-#include <typeinfo>
 #include <stdexcept>
+#include <vector>
 
 namespace ECS {
 
@@ -15,14 +17,15 @@ namespace ECS {
             template<typename T, typename... Args>
             std::shared_ptr<T> RegisterSystem(Args&&... args)
             {
-                const char* typeName = typeid(T).name();
-
-                if (mSystems.find(typeName) != mSystems.end()) {
+                if (mSystemIndices.find(TypeHashOf<T>()) != mSystemIndices.end()) {
                     throw std::runtime_error("Registering system more than once.");
                 }
 
                 auto system = std::make_shared<T>(std::forward<Args>(args)...);
-                mSystems.insert({typeName, system});
+                mSystemIndices.insert({TypeHashOf<T>(), mSystems.size()});
+                mSystems.push_back(system);
+                mSignatures.emplace_back();
+                IndexSystem(mSystems.size() - 1);
                 system->Init();
                 return system;
             }
@@ -30,22 +33,37 @@ namespace ECS {
             template<typename T>
             void SetSignature(Signature signature)
             {
-                const char* typeName = typeid(T).name();
+                auto it = mSystemIndices.find(TypeHashOf<T>());
 
-                if (mSystems.find(typeName) == mSystems.end()) {
+                if (it == mSystemIndices.end()) {
                     throw std::runtime_error("System used before registered.");
                 }
 
-                mSignatures.insert({typeName, signature});
+                UnindexSystem(it->second);
+                mSignatures[it->second] = signature;
+                IndexSystem(it->second);
             }
 
             void EntityDestroyed(Entity entity);
-            void EntitySignatureChanged(Entity entity, Signature entitySignature);
+
+            // Re-tests only the systems that require one of the component
+            // types that differ between the two signatures
+            void EntitySignatureChanged(Entity entity, Signature oldSignature, Signature newSignature);
             void ShutdownAll();
 
      private:
-            std::unordered_map<const char*, Signature> mSignatures;
-            std::unordered_map<const char*, std::shared_ptr<System>> mSystems;
+            void IndexSystem(std::size_t index);
+            void UnindexSystem(std::size_t index);
+            void UpdateMembership(std::size_t index, Entity entity, const Signature& entitySignature);
+
+            // Systems and their signatures share the same index
+            std::vector<Signature> mSignatures;
+            // Indices of the systems whose signature requires each component type
+            std::array<std::vector<std::size_t>, MAX_COMPONENTS> mSystemsByComponent;
+            // Systems with an empty signature match every entity
+            std::vector<std::size_t> mMatchAllSystems;
+            std::vector<std::shared_ptr<System>> mSystems;
+            std::unordered_map<TypeHash, std::size_t> mSystemIndices;
     };
 
 } // namespace ECS
@@ -0,0 +1,119 @@
+#ifndef ENG_ENGINE_ECS_SYSTEMSCHEDULER_HPP
+#define ENG_ENGINE_ECS_SYSTEMSCHEDULER_HPP
+
+#include "Types.hpp"
+#include "System.hpp"
+#include "Coordinator.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Runs systems concurrently according to their declared component access
+     *
+     * Every system declares the component types it reads and writes. Two
+     * systems conflict when one writes a type the other reads or writes (or
+     * when either is exclusive); conflicting systems keep their registration
+     * order through an edge of a dependency DAG, everything else may run at
+     * the same time on the ThreadPool.
+     *
+     * Scheduled systems must not change entity structure from Update: they
+     * record create/destroy/add/remove (e.g. in a CommandBuffer) and apply
+     * them in System::ApplyDeferred, which Run calls serially, in
+     * registration order, after every system has updated.
+     *
+     *   scheduler.Add(animationSystem).Writes<Animation, Sprite>();
+     *   scheduler.Add(lifetimeSystem).Writes<Lifetime>();
+     *   scheduler.Add(scrollingSystem).Reads<ScrollingBackground>().Writes<Position>();
+     *   scheduler.Run(dt);
+     */
+    class SystemScheduler {
+     public:
+            /**
+             * @brief Declares the access of the system just added
+             */
+            class Registration {
+             public:
+                    Registration(SystemScheduler& scheduler, std::size_t index)
+                        : mScheduler(scheduler), mIndex(index) {}
+
+                    template<typename... Ts>
+                    Registration& Reads()
+                    {
+                        (Declare<Ts>(mScheduler.mNodes[mIndex].reads), ...);
+                        return *this;
+                    }
+
+                    template<typename... Ts>
+                    Registration& Writes()
+                    {
+                        (Declare<Ts>(mScheduler.mNodes[mIndex].writes), ...);
+                        return *this;
+                    }
+
+                    // Touches state not described by components: never runs alongside others
+                    Registration& Exclusive()
+                    {
+                        mScheduler.mNodes[mIndex].exclusive = true;
+                        mScheduler.mDirty = true;
+                        return *this;
+                    }
+
+             private:
+                    template<typename T>
+                    void Declare(Signature& access)
+                    {
+                        access.set(mScheduler.mCoordinator->GetComponentType<T>());
+                        mScheduler.mDirty = true;
+                    }
+
+                    SystemScheduler& mScheduler;
+                    std::size_t mIndex;
+            };
+
+            // Without a pool (or with a pool without workers) systems run serially
+            explicit SystemScheduler(Coordinator* coordinator, ThreadPool* pool = nullptr)
+                : mCoordinator(coordinator), mPool(pool) {}
+            ~SystemScheduler();
+
+            SystemScheduler(const SystemScheduler&) = delete;
+            SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+            Registration Add(std::shared_ptr<System> system);
+
+            // Updates every system, then applies their deferred changes
+            void Run(float dt);
+
+            std::size_t Size() const { return mNodes.size(); }
+
+            // True when `later` must wait for `earlier` (both registration indices)
+            bool DependsOn(std::size_t later, std::size_t earlier);
+
+     private:
+            struct Node {
+                std::shared_ptr<System> system;
+                Signature reads;
+                Signature writes;
+                bool exclusive = false;
+                std::vector<std::size_t> successors;
+                std::size_t predecessorCount = 0;
+            };
+
+            static bool Conflicts(const Node& a, const Node& b);
+            void Build();
+            void Launch(std::size_t index, float dt, TaskGroup& group);
+
+            Coordinator* mCoordinator = nullptr;
+            ThreadPool* mPool = nullptr;
+            std::vector<Node> mNodes;
+            std::unique_ptr<std::atomic<std::size_t>[]> mRemaining;
+            bool mDirty = true;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_SYSTEMSCHEDULER_HPP
@@ -58,7 +58,9 @@ namespace ECS {
         void Shutdown() override {}
         
         void Update(float deltaTime) override {
-            std::vector<Entity> entities(mEntities.begin(), mEntities.end());
+            // Pairs in entity order, whatever order the members joined in
+            std::vector<Entity> entities = mEntities.Dense();
+            std::sort(entities.begin(), entities.end());
             
             // Check all pairs of entities
             for (size_t i = 0; i < entities.size(); ++i) {
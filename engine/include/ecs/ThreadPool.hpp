@@ -0,0 +1,96 @@
+#ifndef ENG_ENGINE_ECS_THREADPOOL_HPP
+#define ENG_ENGINE_ECS_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Tasks whose completion can be waited on together
+     *
+     * The first exception thrown by a task of the group is kept and
+     * rethrown by ThreadPool::Wait.
+     */
+    class TaskGroup {
+     public:
+            TaskGroup() = default;
+            TaskGroup(const TaskGroup&) = delete;
+            TaskGroup& operator=(const TaskGroup&) = delete;
+
+            bool Done() const { return mPending.load(std::memory_order_acquire) == 0; }
+
+     private:
+            friend class ThreadPool;
+
+            std::atomic<std::size_t> mPending{0};
+            std::mutex mErrorMutex;
+            std::exception_ptr mError;
+    };
+
+    /**
+     * @brief Fixed set of worker threads with per-worker work-stealing queues
+     *
+     * A task submitted from a worker goes to that worker's own queue (and
+     * is popped LIFO, while it is still hot); tasks submitted from other
+     * threads are spread round-robin. Idle workers steal the oldest task of
+     * another queue. The thread calling Wait() runs tasks too, so a pool
+     * with zero workers simply executes everything on the caller.
+     */
+    class ThreadPool {
+     public:
+            using Task = std::function<void()>;
+
+            // One worker per hardware thread minus the caller's
+            static std::size_t DefaultWorkerCount();
+
+            explicit ThreadPool(std::size_t workerCount = DefaultWorkerCount());
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            std::size_t WorkerCount() const { return mWorkers.size(); }
+
+            void Submit(TaskGroup& group, Task task);
+
+            // Blocks until every task of the group ran, helping meanwhile
+            void Wait(TaskGroup& group);
+
+     private:
+            struct Job {
+                Task task;
+                TaskGroup* group = nullptr;
+            };
+
+            struct Queue {
+                std::mutex mutex;
+                std::deque<Job> jobs;
+            };
+
+            void WorkerLoop(std::size_t index);
+            bool TryPop(std::size_t preferred, Job& job);
+            void Run(Job& job);
+
+            std::vector<std::unique_ptr<Queue>> mQueues;
+            std::vector<std::thread> mWorkers;
+            std::atomic<std::size_t> mNextQueue{0};
+            std::atomic<std::size_t> mQueued{0};
+            std::atomic<bool> mStopping{false};
+
+            std::mutex mWakeMutex;
+            std::condition_variable mWake;
+            std::condition_variable mGroupDone;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_THREADPOOL_HPP
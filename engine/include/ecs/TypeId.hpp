@@ -0,0 +1,111 @@
+#ifndef ENG_ENGINE_ECS_TYPEID_HPP
+#define ENG_ENGINE_ECS_TYPEID_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ECS {
+
+    /**
+     * @brief Compile-time identity of a C++ type
+     *
+     * FNV-1a hash of the compiler's pretty name for T. Unlike a static
+     * counter, the value does not depend on registration or instantiation
+     * order, so it is identical in the game executable and in every system
+     * shared library (each of which links its own copy of the ECS).
+     */
+    using TypeHash = std::uint64_t;
+
+    namespace detail {
+
+        template<typename T>
+        constexpr std::string_view PrettyTypeName()
+        {
+#if defined(_MSC_VER)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        constexpr TypeHash Fnv1a(std::string_view text)
+        {
+            TypeHash hash = 14695981039346656037ull;
+            for (char c : text) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+    } // namespace detail
+
+    template<typename T>
+    constexpr TypeHash TypeHashOf()
+    {
+        constexpr TypeHash hash = detail::Fnv1a(detail::PrettyTypeName<T>());
+        return hash;
+    }
+
+    /**
+     * @brief Fixed-size open-addressing map from TypeHash to a dense index
+     *
+     * Used by the managers to turn a TypeHash into the slot of their flat
+     * storage arrays. Capacity must be a power of two and larger than the
+     * number of inserted types; with a constant key the first probe almost
+     * always hits, so a lookup is a mask, one load and one compare.
+     */
+    template<std::size_t Capacity>
+    class TypeIndexMap {
+     public:
+            static_assert((Capacity & (Capacity - 1)) == 0, "TypeIndexMap capacity must be a power of two.");
+
+            static constexpr std::uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+            // Returns false if the hash is already present or the map is full
+            bool Insert(TypeHash hash, std::uint32_t index)
+            {
+                if (mCount + 1 >= Capacity) {
+                    return false;
+                }
+
+                std::size_t slot = hash & (Capacity - 1);
+                while (mSlots[slot].index != NOT_FOUND) {
+                    if (mSlots[slot].hash == hash) {
+                        return false;
+                    }
+                    slot = (slot + 1) & (Capacity - 1);
+                }
+
+                mSlots[slot] = Slot{hash, index};
+                ++mCount;
+                return true;
+            }
+
+            std::uint32_t Find(TypeHash hash) const
+            {
+                std::size_t slot = hash & (Capacity - 1);
+                while (mSlots[slot].index != NOT_FOUND) {
+                    if (mSlots[slot].hash == hash) {
+                        return mSlots[slot].index;
+                    }
+                    slot = (slot + 1) & (Capacity - 1);
+                }
+                return NOT_FOUND;
+            }
+
+     private:
+            struct Slot {
+                TypeHash hash = 0;
+                std::uint32_t index = NOT_FOUND;
+            };
+
+            std::array<Slot, Capacity> mSlots{};
+            std::size_t mCount = 0;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_TYPEID_HPP
@@ -3,12 +3,35 @@
 
 #include <cstdint>
 #include <bitset>
+#include <limits>
 
 namespace ECS {
 
 // Entity is just a unique ID (local to this process)
 using Entity = std::uint32_t;
 
+// Index value no entity ever uses (null handle)
+constexpr Entity NULL_ENTITY = std::numeric_limits<Entity>::max();
+
+// Reference to an entity that can outlive it: the slot index plus the
+// generation of that slot when the handle was taken. Destroying an entity
+// bumps its slot's version, so Coordinator::IsAlive rejects every handle
+// taken before, even once the index is recycled.
+// A default-constructed handle is null and never alive.
+struct EntityHandle {
+    Entity index = NULL_ENTITY;
+    std::uint32_t version = 0;
+
+    bool IsNull() const { return index == NULL_ENTITY; }
+
+    // Spelled out: the server and tests still build as C++17
+    friend bool operator==(const EntityHandle& a, const EntityHandle& b)
+    {
+        return a.index == b.index && a.version == b.version;
+    }
+    friend bool operator!=(const EntityHandle& a, const EntityHandle& b) { return !(a == b); }
+};
+
 // NetworkId is used to identify entities across the network
 // Server assigns these IDs, clients use them to map to local entities
 using NetworkId = std::uint32_t;
@@ -16,12 +39,20 @@ using NetworkId = std::uint32_t;
 // ComponentType is used to identify component types
 using ComponentType = std::uint8_t;
 
-// Maximum number of entities in the system
-constexpr Entity MAX_ENTITIES = 5000;
+// Default cap on living entities (Coordinator::SetMaxEntities changes it at runtime)
+// Entity storage is paged, so the cap costs no memory; it only stops runaway spawning
+constexpr Entity DEFAULT_MAX_ENTITIES = 1u << 20;
+
+// Destroyed IDs are only reused once this many wait in the free queue, which
+// keeps recently destroyed IDs out of circulation for a while
+constexpr std::uint32_t MIN_FREE_ENTITIES = 1024;
 
 // Maximum number of component types
 constexpr ComponentType MAX_COMPONENTS = 64;
 
+// Number of entity slots per page of a sparse set index (power of two)
+constexpr std::uint32_t SPARSE_PAGE_SIZE = 1024;
+
 // Invalid network ID (used for local-only entities)
 constexpr NetworkId INVALID_NETWORK_ID = 0;
 
@@ -30,6 +61,19 @@ constexpr NetworkId INVALID_NETWORK_ID = 0;
 // Example: 0b00000101 means the entity has components 0 and 2
 using Signature = std::bitset<MAX_COMPONENTS>;
 
+// How the ComponentManager lays out component data
+// - SparseSet: one packed ComponentArray per component type (default)
+// - Archetype: entities with the same Signature share SoA chunks. Removing a
+//   row (AddComponent/RemoveComponent/DestroyEntity) moves the archetype's
+//   last row into the hole, so it invalidates component references held for
+//   other entities too. A View iterated while components are added can visit
+//   an entity twice, once more in the later archetype it moved into; record
+//   such changes in a CommandBuffer and apply them after the loop.
+enum class StorageMode {
+    SparseSet,
+    Archetype
+};
+
 } // namespace ECS
 
 #endif // ENG_ENGINE_ECS_TYPES_HPP
@@ -0,0 +1,270 @@
+#ifndef ENG_ENGINE_ECS_VIEW_HPP
+#define ENG_ENGINE_ECS_VIEW_HPP
+
+#include "Types.hpp"
+#include "ComponentArray.hpp"
+#include "Archetype.hpp"
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Typed query over every entity owning all of Ts...
+     *
+     * Obtained from Coordinator::View<Ts...>(). The component arrays are
+     * resolved once when the view is built; iteration then walks the dense
+     * entity list of the smallest participating pool and probes the other
+     * pools through their sparse index, with no per-entity type lookup.
+     *
+     * Usage:
+     *   coordinator.View<Position, Velocity>().Each(
+     *       [dt](ECS::Entity, Position& pos, Velocity& vel) {
+     *           pos.x += vel.dx * dt;
+     *       });
+     *
+     *   for (auto [entity, pos, vel] : coordinator.View<Position, Velocity>()) { ... }
+     *
+     * In StorageMode::Archetype the view instead walks the chunk columns of
+     * every archetype whose Signature contains Ts..., a linear scan with no
+     * per-entity lookup at all.
+     *
+     * Pools (or archetypes) are walked from their back, so destroying (or
+     * removing a viewed component from) the entity currently visited is
+     * safe; entities created during iteration are not visited.
+     */
+    template<typename... Ts>
+    class View {
+     public:
+            static_assert(sizeof...(Ts) > 0, "View needs at least one component type.");
+
+            explicit View(ComponentArray<Ts>*... arrays)
+                : mArrays(arrays...)
+            {
+                // Lead with the smallest pool: fewest candidates to test
+                mLead = &std::get<0>(mArrays)->Entities();
+                ((arrays->Size() < mLead->size() ? (void)(mLead = &arrays->Entities()) : (void)0), ...);
+            }
+
+            View(ArchetypeStorage* storage, std::array<ComponentType, sizeof...(Ts)> types)
+                : mStorage(storage), mTypes(types)
+            {
+                Signature required;
+                for (ComponentType type : mTypes) {
+                    required.set(type);
+                }
+                for (const auto& archetype : storage->GetArchetypes()) {
+                    if ((archetype->GetSignature() & required) == required) {
+                        mMatches.push_back(archetype.get());
+                    }
+                }
+            }
+
+            class Iterator {
+             public:
+                    using value_type = std::tuple<Entity, Ts&...>;
+
+                    Iterator(const View* view, std::size_t archetype, std::size_t remaining)
+                        : mView(view), mArchetype(archetype), mRemaining(remaining)
+                    {
+                        SkipMismatches();
+                    }
+
+                    value_type operator*() const
+                    {
+                        if (mView->mStorage) {
+                            const Archetype& archetype = *mView->mMatches[mArchetype];
+                            return Fetch(archetype, mRemaining - 1, std::index_sequence_for<Ts...>{});
+                        }
+                        Entity entity = (*mView->mLead)[mRemaining - 1];
+                        return value_type(entity, *std::get<ComponentArray<Ts>*>(mView->mArrays)->TryGetData(entity)...);
+                    }
+
+                    Iterator& operator++()
+                    {
+                        --mRemaining;
+                        SkipMismatches();
+                        return *this;
+                    }
+
+                    bool operator==(const Iterator& other) const
+                    {
+                        return mArchetype == other.mArchetype && mRemaining == other.mRemaining;
+                    }
+                    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+             private:
+                    template<std::size_t... I>
+                    value_type Fetch(const Archetype& archetype, std::size_t row, std::index_sequence<I...>) const
+                    {
+                        return value_type(archetype.EntityAt(row),
+                            *static_cast<Ts*>(archetype.ComponentAt(mView->mTypes[I], row))...);
+                    }
+
+                    void SkipMismatches()
+                    {
+                        if (mView->mStorage) {
+                            // Every row of a matching archetype matches; hop over empty tails
+                            const auto& matches = mView->mMatches;
+                            while (mArchetype < matches.size()) {
+                                if (mRemaining > matches[mArchetype]->Size()) {
+                                    mRemaining = matches[mArchetype]->Size();
+                                }
+                                if (mRemaining > 0) {
+                                    return;
+                                }
+                                if (++mArchetype < matches.size()) {
+                                    mRemaining = matches[mArchetype]->Size();
+                                }
+                            }
+                            return;
+                        }
+
+                        // The lead pool may shrink under us if the body destroyed entities
+                        if (mRemaining > mView->mLead->size()) {
+                            mRemaining = mView->mLead->size();
+                        }
+                        while (mRemaining > 0 && !mView->Contains((*mView->mLead)[mRemaining - 1])) {
+                            --mRemaining;
+                        }
+                    }
+
+                    const View* mView;
+                    std::size_t mArchetype;
+                    std::size_t mRemaining;
+            };
+
+            Iterator begin() const
+            {
+                if (mStorage) {
+                    return Iterator(this, 0, mMatches.empty() ? 0 : mMatches.front()->Size());
+                }
+                return Iterator(this, 0, mLead->size());
+            }
+
+            Iterator end() const { return Iterator(this, mStorage ? mMatches.size() : 0, 0); }
+
+            // Calls func(Entity, Ts&...) for each matching entity
+            template<typename Func>
+            void Each(Func&& func) const
+            {
+                EachInRange(0, SizeHint(), func);
+            }
+
+            /**
+             * @brief Each() restricted to candidates [first, last)
+             *
+             * Candidates are numbered 0..SizeHint() over the lead pool (or,
+             * in archetype mode, over the rows of the matching archetypes
+             * one after the other). Disjoint ranges touch disjoint
+             * entities, which is what ParallelForEach splits on.
+             */
+            template<typename Func>
+            void EachInRange(std::size_t first, std::size_t last, Func&& func) const
+            {
+                if (mStorage) {
+                    std::size_t base = 0;
+                    for (Archetype* archetype : mMatches) {
+                        const std::size_t size = archetype->Size();
+                        const std::size_t begin = first > base ? first - base : 0;
+                        const std::size_t end = last - base < size ? last - base : size;
+                        if (begin < end) {
+                            EachInArchetype(*archetype, begin, end, func, std::index_sequence_for<Ts...>{});
+                        }
+                        base += size;
+                        if (base >= last) {
+                            break;
+                        }
+                    }
+                    return;
+                }
+
+                std::size_t i = last;
+                while (i > first) {
+                    --i;
+                    // The lead pool may shrink under us if func destroyed entities
+                    if (i >= mLead->size()) {
+                        i = mLead->size();
+                        continue;
+                    }
+                    Entity entity = (*mLead)[i];
+                    std::tuple<Ts*...> components(std::get<ComponentArray<Ts>*>(mArrays)->TryGetData(entity)...);
+                    if ((std::get<Ts*>(components) && ...)) {
+                        func(entity, *std::get<Ts*>(components)...);
+                    }
+                }
+            }
+
+            bool Contains(Entity entity) const
+            {
+                if (mStorage) {
+                    return (mStorage->Has(entity, mTypes[IndexOf<Ts>()]) && ...);
+                }
+                return (std::get<ComponentArray<Ts>*>(mArrays)->HasData(entity) && ...);
+            }
+
+            // Upper bound on the number of entities the view yields
+            std::size_t SizeHint() const
+            {
+                if (mStorage) {
+                    std::size_t size = 0;
+                    for (const Archetype* archetype : mMatches) {
+                        size += archetype->Size();
+                    }
+                    return size;
+                }
+                return mLead->size();
+            }
+
+     private:
+            template<typename T>
+            static constexpr std::size_t IndexOf()
+            {
+                constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+                for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+                    if (matches[i]) {
+                        return i;
+                    }
+                }
+                return 0;
+            }
+
+            // Walks rows [first, last) of one archetype back to front straight from the chunk columns
+            template<typename Func, std::size_t... I>
+            void EachInArchetype(const Archetype& archetype, std::size_t first, std::size_t last,
+                Func& func, std::index_sequence<I...>) const
+            {
+                const std::array<std::size_t, sizeof...(Ts)> offsets{archetype.ColumnOffset(mTypes[I])...};
+                const std::size_t shift = archetype.ChunkShift();
+                const std::size_t mask = archetype.ChunkMask();
+
+                std::size_t row = last;
+                while (row > first) {
+                    --row;
+                    if (row >= archetype.Size()) {
+                        row = archetype.Size();
+                        continue;
+                    }
+                    std::byte* chunk = archetype.ChunkData(row >> shift);
+                    const std::size_t slot = row & mask;
+                    func(reinterpret_cast<Entity*>(chunk)[slot], reinterpret_cast<Ts*>(chunk + offsets[I])[slot]...);
+                }
+            }
+
+            // StorageMode::SparseSet
+            std::tuple<ComponentArray<Ts>*...> mArrays;
+            const std::vector<Entity>* mLead = nullptr;
+
+            // StorageMode::Archetype
+            ArchetypeStorage* mStorage = nullptr;
+            std::array<ComponentType, sizeof...(Ts)> mTypes{};
+            std::vector<Archetype*> mMatches;
+    };
+
+} // namespace ECS
+
+#endif // ENG_ENGINE_ECS_VIEW_HPP
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Network {
+
+    /**
+     * @brief Bit-level counterpart of Serializer, for fields narrower than a byte
+     *
+     * Bits are packed LSB first into a byte buffer; the last byte is zero
+     * padded. Besides fixed-width integers it writes varints in groups of
+     * `groupBits` value bits plus a continuation bit (small group sizes
+     * suit fields that are almost always tiny), zig-zag signed varints and
+     * floats quantized over a known range. Values that do not fit their
+     * declared width throw instead of being silently truncated.
+     */
+    class BitWriter {
+    public:
+        BitWriter() = default;
+
+        // Packed bytes; the last one is zero padded
+        const std::vector<char>& getBuffer() const {
+            return buffer_;
+        }
+
+        size_t getBitCount() const {
+            return bitCount_;
+        }
+
+        // Write the low `bits` bits of value (0 to 32)
+        void writeBits(uint32_t value, unsigned bits) {
+            if (bits > 32) {
+                throw std::runtime_error("BitWriter: more than 32 bits requested");
+            }
+            if (bits < 32 && (value >> bits) != 0) {
+                throw std::runtime_error("BitWriter: " + std::to_string(value) + " does not fit in " + std::to_string(bits) + " bits");
+            }
+            while (bits > 0) {
+                const unsigned used = static_cast<unsigned>(bitCount_ & 7);
+                if (used == 0) {
+                    buffer_.push_back(0);
+                }
+                const unsigned take = std::min(8u - used, bits);
+                const uint32_t chunk = value & ((1u << take) - 1);
+                buffer_.back() = static_cast<char>(static_cast<uint8_t>(buffer_.back()) | (chunk << used));
+                value >>= take;
+                bits -= take;
+                bitCount_ += take;
+            }
+        }
+
+        void writeBool(bool value) {
+            writeBits(value ? 1u : 0u, 1);
+        }
+
+        // Two's complement in `bits` bits (1 to 32)
+        void writeSigned(int32_t value, unsigned bits) {
+            if (bits == 0 || bits > 32) {
+                throw std::runtime_error("BitWriter: signed width must be 1 to 32 bits");
+            }
+            if (bits < 32) {
+                const int64_t limit = int64_t(1) << (bits - 1);
+                if (value < -limit || value >= limit) {
+                    throw std::runtime_error("BitWriter: " + std::to_string(value) + " does not fit in " + std::to_string(bits) + " signed bits");
+                }
+            }
+            const uint32_t mask = bits < 32 ? (1u << bits) - 1 : 0xFFFFFFFFu;
+            writeBits(static_cast<uint32_t>(value) & mask, bits);
+        }
+
+        // groupBits value bits per group, each followed by a continuation bit
+        void writeVarint(uint32_t value, unsigned groupBits = 7) {
+            checkGroupBits(groupBits);
+            const uint32_t groupMask = (1u << groupBits) - 1;
+            do {
+                const uint32_t group = value & groupMask;
+                value >>= groupBits;
+                writeBits(group, groupBits);
+                writeBool(value != 0);
+            } while (value != 0);
+        }
+
+        // Zig-zag mapping keeps small negative values short
+        void writeSignedVarint(int32_t value, unsigned groupBits = 7) {
+            writeVarint(zigZag(value), groupBits);
+        }
+
+        /**
+         * @brief Quantizes value over [min, max] to `bits` bits (1 to 31)
+         *
+         * Out of range values are clamped; the decoded value is within
+         * (max - min) / (2^bits - 1) / 2 of the clamped one.
+         */
+        void writeQuantized(float value, float min, float max, unsigned bits) {
+            const uint32_t steps = quantizationSteps(min, max, bits);
+            float normalized = (value - min) / (max - min);
+            if (!(normalized > 0.0f)) {
+                normalized = 0.0f; // Also catches NaN
+            }
+            normalized = std::min(normalized, 1.0f);
+            const auto quantized = static_cast<uint32_t>(std::llround(static_cast<double>(normalized) * steps));
+            writeBits(std::min(quantized, steps), bits);
+        }
+
+        static uint32_t zigZag(int32_t value) {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        static void checkGroupBits(unsigned groupBits) {
+            if (groupBits == 0 || groupBits > 31) {
+                throw std::runtime_error("BitStream: varint group must be 1 to 31 bits");
+            }
+        }
+
+        static uint32_t quantizationSteps(float min, float max, unsigned bits) {
+            if (bits == 0 || bits > 31) {
+                throw std::runtime_error("BitStream: quantized width must be 1 to 31 bits");
+            }
+            if (!(max > min)) {
+                throw std::runtime_error("BitStream: empty quantization range");
+            }
+            return (1u << bits) - 1;
+        }
+
+    private:
+        std::vector<char> buffer_;
+        size_t bitCount_ = 0;
+    };
+
+    /**
+     * @brief Reads what a BitWriter wrote
+     *
+     * Does not copy: the buffer must outlive the reader. Every read is
+     * bounds checked and throws on underflow, like Deserializer.
+     */
+    class BitReader {
+    public:
+        BitReader(const std::vector<char>& data) : data_(data.data()), size_(data.size()) {}
+        BitReader(std::vector<char>&&) = delete; // Would dangle
+        BitReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+        uint32_t readBits(unsigned bits) {
+            if (bits > 32) {
+                throw std::runtime_error("BitReader: more than 32 bits requested");
+            }
+            if (bits > getBitsRemaining()) {
+                throw std::runtime_error("BitReader: Buffer underflow");
+            }
+            uint32_t value = 0;
+            unsigned written = 0;
+            while (written < bits) {
+                const unsigned used = static_cast<unsigned>(bitOffset_ & 7);
+                const unsigned take = std::min(8u - used, bits - written);
+                const uint32_t byte = static_cast<uint8_t>(data_[bitOffset_ >> 3]);
+                value |= ((byte >> used) & ((1u << take) - 1)) << written;
+                written += take;
+                bitOffset_ += take;
+            }
+            return value;
+        }
+
+        bool readBool() {
+            return readBits(1) != 0;
+        }
+
+        int32_t readSigned(unsigned bits) {
+            if (bits == 0 || bits > 32) {
+                throw std::runtime_error("BitReader: signed width must be 1 to 32 bits");
+            }
+            const uint32_t value = readBits(bits);
+            if (bits < 32 && (value & (1u << (bits - 1)))) {
+                return static_cast<int32_t>(value | ~((1u << bits) - 1));
+            }
+            return static_cast<int32_t>(value);
+        }
+
+        uint32_t readVarint(unsigned groupBits = 7) {
+            BitWriter::checkGroupBits(groupBits);
+            uint64_t value = 0;
+            unsigned shift = 0;
+            bool more = true;
+            while (more) {
+                if (shift >= 32) {
+                    throw std::runtime_error("BitReader: Varint too long");
+                }
+                value |= static_cast<uint64_t>(readBits(groupBits)) << shift;
+                shift += groupBits;
+                more = readBool();
+            }
+            if (value > 0xFFFFFFFFu) {
+                throw std::runtime_error("BitReader: Varint overflows 32 bits");
+            }
+            return static_cast<uint32_t>(value);
+        }
+
+        int32_t readSignedVarint(unsigned groupBits = 7) {
+            const uint32_t value = readVarint(groupBits);
+            return static_cast<int32_t>((value >> 1) ^ (0u - (value & 1u)));
+        }
+
+        float readQuantized(float min, float max, unsigned bits) {
+            const uint32_t steps = BitWriter::quantizationSteps(min, max, bits);
+            return min + (max - min) * (static_cast<float>(readBits(bits)) / static_cast<float>(steps));
+        }
+
+        size_t getBitsRemaining() const {
+            return size_ * 8 - bitOffset_;
+        }
+
+    private:
+        const char* data_;
+        size_t size_;
+        size_t bitOffset_ = 0;
+    };
+
+}
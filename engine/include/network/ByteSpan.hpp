@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Network {
+
+    /**
+     * @brief Read-only view of contiguous bytes, std::span<const char> for the C++17 targets
+     *
+     * Never owns: whoever hands one out keeps the bytes alive (a
+     * std::vector, or the PacketRef of a received PacketView).
+     */
+    class ByteSpan {
+    public:
+        ByteSpan() = default;
+        ByteSpan(const char* data, size_t size) : data_(data), size_(size) {}
+        ByteSpan(const std::vector<char>& bytes) : data_(bytes.data()), size_(bytes.size()) {}
+
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        const char* begin() const { return data_; }
+        const char* end() const { return data_ + size_; }
+        char operator[](size_t index) const { return data_[index]; }
+
+        // Bytes from `offset` to the end
+        ByteSpan subspan(size_t offset) const {
+            if (offset > size_) {
+                throw std::runtime_error("ByteSpan: offset past the end");
+            }
+            return ByteSpan(data_ + offset, size_ - offset);
+        }
+
+    private:
+        const char* data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+}
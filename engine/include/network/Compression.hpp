@@ -1,7 +1,12 @@
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
 
 namespace Network {
 
@@ -40,4 +45,204 @@ namespace Network {
         }
     };
 
+    /**
+     * @brief Byte-oriented LZ77 in the LZ4 block layout: no entropy stage, built for speed
+     *
+     * Output: varint original size, then sequences of
+     *   token (literal count << 4 | match length - 4), [literal count
+     *   extension], literals, offset (uint16 LE), [match length extension]
+     * where a nibble of 15 is extended by bytes summed until one is not
+     * 255. The last sequence stops after its literals. Matches are found
+     * through a 4096-entry hash of the next 4 bytes, within 64 KB.
+     *
+     * decompress() checks every length and offset against its input and
+     * maxSize and throws on corrupt data, so it is safe on datagrams.
+     */
+    class LzCompression {
+    public:
+        static std::vector<char> compress(const std::vector<char>& data) {
+            return compress(data.data(), data.size());
+        }
+
+        static std::vector<char> compress(const char* data, size_t size) {
+            std::vector<char> output;
+            output.reserve(size + size / 255 + 16);
+            writeVarint(output, size);
+
+            const auto* in = reinterpret_cast<const uint8_t*>(data);
+            std::array<int64_t, HASH_SIZE> table;
+            table.fill(-1);
+
+            size_t anchor = 0;
+            size_t i = 0;
+            while (i + MIN_MATCH <= size) {
+                const uint32_t sequence = read32(in + i);
+                const uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+                const int64_t candidate = table[hash];
+                table[hash] = static_cast<int64_t>(i);
+
+                if (candidate >= 0 && i - static_cast<size_t>(candidate) <= MAX_OFFSET &&
+                    read32(in + candidate) == sequence) {
+                    size_t length = MIN_MATCH;
+                    while (i + length < size && in[candidate + length] == in[i + length]) {
+                        ++length;
+                    }
+                    writeSequence(output, in + anchor, i - anchor, i - static_cast<size_t>(candidate), length);
+                    i += length;
+                    anchor = i;
+                } else {
+                    // Skip faster through data that does not match (LZ4's acceleration)
+                    i += 1 + ((i - anchor) >> 6);
+                }
+            }
+            writeSequence(output, in + anchor, size - anchor, 0, 0);
+            return output;
+        }
+
+        static std::vector<char> decompress(const std::vector<char>& data, size_t maxSize = 65536) {
+            return decompress(data.data(), data.size(), maxSize);
+        }
+
+        static std::vector<char> decompress(const char* data, size_t size, size_t maxSize = 65536) {
+            const size_t originalSize = decompressedSize(data, size);
+            if (originalSize > maxSize) {
+                throw std::runtime_error("LzCompression: output larger than allowed");
+            }
+            std::vector<char> output(originalSize);
+            decompress(data, size, output.data(), output.size());
+            return output;
+        }
+
+        // Size the block inflates to, read from its header
+        static size_t decompressedSize(const char* data, size_t size) {
+            const auto* in = reinterpret_cast<const uint8_t*>(data);
+            return readVarint(in, in + size);
+        }
+
+        // Inflates into out[0, capacity) without allocating; returns the decompressed size
+        static size_t decompress(const char* data, size_t size, char* out, size_t capacity) {
+            const auto* in = reinterpret_cast<const uint8_t*>(data);
+            const uint8_t* end = in + size;
+            const size_t originalSize = readVarint(in, end);
+            if (originalSize > capacity) {
+                throw std::runtime_error("LzCompression: output larger than allowed");
+            }
+
+            size_t produced = 0;
+            while (true) {
+                if (in >= end) {
+                    throw std::runtime_error("LzCompression: truncated input");
+                }
+                const uint8_t token = *in++;
+
+                const size_t literals = readLength(token >> 4, in, end);
+                if (literals > static_cast<size_t>(end - in) || literals > originalSize - produced) {
+                    throw std::runtime_error("LzCompression: literal run out of bounds");
+                }
+                if (literals != 0) {
+                    std::memcpy(out + produced, in, literals);
+                }
+                produced += literals;
+                in += literals;
+                if (produced == originalSize) {
+                    break;
+                }
+
+                if (end - in < 2) {
+                    throw std::runtime_error("LzCompression: truncated input");
+                }
+                const size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+                in += 2;
+                const size_t length = readLength(token & 0x0F, in, end) + MIN_MATCH;
+                if (offset == 0 || offset > produced || length > originalSize - produced) {
+                    throw std::runtime_error("LzCompression: match out of bounds");
+                }
+                // Byte by byte: the match may overlap what it is producing
+                for (size_t k = 0; k < length; ++k, ++produced) {
+                    out[produced] = out[produced - offset];
+                }
+            }
+            return originalSize;
+        }
+
+    private:
+        static constexpr unsigned HASH_BITS = 12;
+        static constexpr size_t HASH_SIZE = size_t(1) << HASH_BITS;
+        static constexpr size_t MIN_MATCH = 4;
+        static constexpr size_t MAX_OFFSET = 65535;
+
+        static uint32_t read32(const uint8_t* ptr) {
+            uint32_t value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+
+        static void writeVarint(std::vector<char>& output, size_t value) {
+            while (value >= 0x80) {
+                output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            output.push_back(static_cast<char>(value));
+        }
+
+        static size_t readVarint(const uint8_t*& in, const uint8_t* end) {
+            size_t value = 0;
+            for (unsigned shift = 0; shift < 35; shift += 7) {
+                if (in >= end) {
+                    throw std::runtime_error("LzCompression: truncated size");
+                }
+                const uint8_t byte = *in++;
+                value |= static_cast<size_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return value;
+                }
+            }
+            throw std::runtime_error("LzCompression: size too long");
+        }
+
+        static void writeLengthExtension(std::vector<char>& output, size_t length) {
+            for (length -= 15; length >= 255; length -= 255) {
+                output.push_back(static_cast<char>(255));
+            }
+            output.push_back(static_cast<char>(length));
+        }
+
+        static size_t readLength(size_t nibble, const uint8_t*& in, const uint8_t* end) {
+            size_t length = nibble;
+            if (nibble == 15) {
+                uint8_t byte = 255;
+                while (byte == 255) {
+                    if (in >= end) {
+                        throw std::runtime_error("LzCompression: truncated length");
+                    }
+                    byte = *in++;
+                    length += byte;
+                }
+            }
+            return length;
+        }
+
+        // A match length of 0 ends the block after the literals
+        static void writeSequence(std::vector<char>& output, const uint8_t* literals, size_t literalCount,
+                                  size_t offset, size_t matchLength) {
+            const size_t matchCode = matchLength ? matchLength - MIN_MATCH : 0;
+            const uint8_t token = static_cast<uint8_t>((std::min<size_t>(literalCount, 15) << 4) |
+                                                       std::min<size_t>(matchCode, 15));
+            output.push_back(static_cast<char>(token));
+            if (literalCount >= 15) {
+                writeLengthExtension(output, literalCount);
+            }
+            output.insert(output.end(), reinterpret_cast<const char*>(literals),
+                          reinterpret_cast<const char*>(literals) + literalCount);
+            if (matchLength == 0) {
+                return;
+            }
+            output.push_back(static_cast<char>(offset & 0xFF));
+            output.push_back(static_cast<char>(offset >> 8));
+            if (matchCode >= 15) {
+                writeLengthExtension(output, matchCode);
+            }
+        }
+    };
+
 }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <asio.hpp>
-#include <queue>
 #include <mutex>
 #include <thread>
 #include <chrono>
@@ -27,10 +26,14 @@ public:
 
     // Check if packets are available
     bool hasReceivedPackets();
-    NetworkPacket getNextReceivedPacket();
+    PacketView getNextReceivedPacket();
 
     void update(float dt);
 
+    // Depth and drop counters of the queues between the I/O and game threads
+    Network::QueueStats getInboundQueueStats() const { return client_.getInboundStats(); }
+    Network::QueueStats getOutboundQueueStats() const { return client_.getOutboundStats(); }
+
     // Connection status
     bool isConnected() const { return connected_; }
     uint8_t getPlayerId() const { return playerId_; }
@@ -41,8 +44,13 @@ private:
     std::thread io_thread_;
     UdpClient client_;
     
-    std::queue<NetworkPacket> receivedPackets_;
+    // Packets of this process() call, read from receivedHead_; the
+    // capacity is kept once drained so steady state does not allocate
+    std::vector<PacketView> receivedPackets_;
+    size_t receivedHead_ = 0;
     std::mutex packetsMutex_;
+    uint64_t reportedInboundDrops_ = 0;
+    uint64_t reportedOutboundDrops_ = 0;
     
     uint32_t sequenceNumber_;
     uint8_t playerId_;
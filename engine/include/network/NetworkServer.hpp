@@ -1,7 +1,6 @@
 #pragma once
 
 #include <asio.hpp>
-#include <queue>
 #include <mutex>
 #include <thread>
 #include <utility>
@@ -18,7 +17,7 @@ public:
     void process();
 
     bool hasReceivedPackets();
-    std::pair<NetworkPacket, asio::ip::udp::endpoint> getNextReceivedPacket();
+    std::pair<PacketView, asio::ip::udp::endpoint> getNextReceivedPacket();
     
     RoomManager& getRoomManager() { return roomManager_; }
 
@@ -26,15 +25,30 @@ public:
     void sendTo(const NetworkPacket& packet, const asio::ip::udp::endpoint& endpoint);
     void checkTimeouts();
 
+    // Depth and drop counters of the queues between the I/O and game threads
+    Network::QueueStats getInboundQueueStats() const { return server_.getInboundStats(); }
+    Network::QueueStats getOutboundQueueStats() const { return server_.getOutboundStats(); }
+
     void removeClient(const asio::ip::udp::endpoint& endpoint);
     std::shared_ptr<ClientSession> getSession(const asio::ip::udp::endpoint& endpoint);
     std::vector<ClientSession> getActiveSessions() const;
 
 private:
+    // Logs drops counted since the last call
+    void reportDrops();
+
     asio::io_context io_context_;
     std::thread io_thread_;
     UdpServer server_;
-    std::queue<std::pair<NetworkPacket, asio::ip::udp::endpoint>> receivedPackets_;
+    // Batch popped from the inbound ring, reused between calls
+    std::vector<std::pair<PacketView, asio::ip::udp::endpoint>> incoming_;
+    uint64_t reportedInboundDrops_ = 0;
+    uint64_t reportedOutboundDrops_ = 0;
+
+    // Game packets of this process() call, read from receivedHead_; the
+    // capacity is kept once drained so steady state does not allocate
+    std::vector<std::pair<PacketView, asio::ip::udp::endpoint>> receivedPackets_;
+    size_t receivedHead_ = 0;
     std::mutex packetsMutex_;
     RoomManager roomManager_;
 };
\ No newline at end of file
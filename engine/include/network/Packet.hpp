@@ -6,6 +6,8 @@
 #include <stdexcept>
 #include <iostream>
 #include "Serializer.hpp"
+#include "Compression.hpp"
+#include "PacketBuffer.hpp"
 
 #ifdef _WIN32
 #elif defined(__APPLE__)
@@ -19,13 +21,15 @@
 struct PacketHeader {
     uint16_t magic;      // 0x5254 ('RT')
     uint8_t  version;    // Protocol version
-    uint8_t  flags;      // Flags (1 = Compressed)
+    uint8_t  flags;      // Flags (FLAG_COMPRESSED)
     uint16_t type;       // Packet type
     uint32_t seq;        // Sequence number
     uint32_t timestamp;  // Timestamp in ms
 
-    PacketHeader() : magic(0x5254), version(1), flags(0), type(0), seq(0), timestamp(0) {}
+    // Payload is an LzCompression block; NetworkPacket::deserialize inflates it
+    static constexpr uint8_t FLAG_COMPRESSED = 0x01;
 
+    PacketHeader() : magic(0x5254), version(1), flags(0), type(0), seq(0), timestamp(0) {}
 
 
     // Serialize to buffer
@@ -35,10 +39,11 @@ struct PacketHeader {
         return serializer.getBuffer();
     }
 
-    // Deserialize from buffer
+    // Deserialize from buffer (read in place; data holds at least sizeof(PacketHeader) bytes)
     static PacketHeader deserialize(const char* data) {
-        Network::Deserializer deserializer(data, sizeof(PacketHeader));
-        return deserializer.read<PacketHeader>();
+        PacketHeader header;
+        std::memcpy(&header, data, sizeof(PacketHeader));
+        return header;
     }
 };
 
@@ -50,6 +55,9 @@ public:
     PacketHeader header;
     std::vector<char> payload;
 
+    static constexpr size_t COMPRESSION_THRESHOLD = 64;
+    static constexpr size_t MAX_PAYLOAD_SIZE = 65536;
+
     NetworkPacket(uint16_t type = 0) {
         header.type = type;
     }
@@ -64,7 +72,33 @@ public:
         return serializer.getBuffer();
     }
 
-    // Deserialize full packet from buffer
+    /**
+     * @brief serialize(), with the payload LZ-compressed when that makes it smaller
+     *
+     * Small payloads (inputs, acks) are sent as is: below
+     * COMPRESSION_THRESHOLD bytes the codec rarely wins. Payloads it
+     * cannot shrink fall back to the plain encoding, so enabling the stage
+     * never costs bandwidth. Snapshots still carry repeated records
+     * (missile volleys, monster waves) after bit packing; see
+     * tests/benchmarks/CompressionBenchmark.cpp for ratios.
+     */
+    std::vector<char> serializeCompressed() const {
+        if (payload.size() < COMPRESSION_THRESHOLD || (header.flags & PacketHeader::FLAG_COMPRESSED)) {
+            return serialize();
+        }
+        std::vector<char> compressed = Network::LzCompression::compress(payload);
+        if (compressed.size() >= payload.size()) {
+            return serialize();
+        }
+        PacketHeader compressedHeader = header;
+        compressedHeader.flags |= PacketHeader::FLAG_COMPRESSED;
+        Network::Serializer serializer;
+        serializer.write(compressedHeader);
+        serializer.writeBytes(compressed.data(), compressed.size());
+        return serializer.getBuffer();
+    }
+
+    // Deserialize full packet from buffer; compressed payloads come back inflated, flag cleared
     static NetworkPacket deserialize(const char* data, size_t size) {
         if (size < sizeof(PacketHeader)) {
             throw std::runtime_error("Packet too short");
@@ -79,6 +113,10 @@ public:
         if (payloadSize > 0) {
             packet.payload = deserializer.readBytes(payloadSize);
         }
+        if (packet.header.flags & PacketHeader::FLAG_COMPRESSED) {
+            packet.payload = Network::LzCompression::decompress(packet.payload, MAX_PAYLOAD_SIZE);
+            packet.header.flags &= static_cast<uint8_t>(~PacketHeader::FLAG_COMPRESSED);
+        }
         return packet;
     }
     
@@ -86,3 +124,67 @@ public:
         payload = newPayload;
     }
 };
+
+/**
+ * @brief A received packet, read in place from its pooled datagram buffer
+ *
+ * What UdpServer and UdpClient hand to the game: the header is decoded
+ * from the first bytes of the buffer and the payload is a span over the
+ * rest, kept alive by the PacketRef the view holds. Copying a view shares
+ * the buffer, so from socket to handler a datagram is never copied and,
+ * once the pool is warm, never allocates. Compressed payloads are inflated
+ * into a second pooled buffer by parse().
+ */
+class PacketView {
+public:
+    PacketHeader header;
+    Network::ByteSpan payload; // Points into the pooled buffer
+
+    // Header + payload as a contiguous packet, compressed flag cleared
+    Network::ByteSpan bytes() const {
+        return buffer_ ? Network::ByteSpan(buffer_->data(), buffer_->size()) : Network::ByteSpan();
+    }
+
+    // Owning copy, for code that keeps or edits the packet
+    NetworkPacket toPacket() const {
+        NetworkPacket packet;
+        packet.header = header;
+        packet.payload.assign(payload.begin(), payload.end());
+        return packet;
+    }
+
+    /**
+     * @brief Parses the datagram in `buffer` (its size set to the bytes received)
+     *
+     * Throws like NetworkPacket::deserialize on malformed data, and when
+     * no buffer is left in `pool` to inflate a compressed payload.
+     */
+    static PacketView parse(Network::PacketRef buffer, Network::PacketBufferPool& pool) {
+        if (!buffer || buffer->size() < sizeof(PacketHeader)) {
+            throw std::runtime_error("Packet too short");
+        }
+        PacketView view;
+        view.header = PacketHeader::deserialize(buffer->data());
+
+        if (view.header.flags & PacketHeader::FLAG_COMPRESSED) {
+            Network::PacketRef inflated = pool.acquire();
+            if (!inflated) {
+                throw std::runtime_error("PacketView: buffer pool exhausted");
+            }
+            view.header.flags &= static_cast<uint8_t>(~PacketHeader::FLAG_COMPRESSED);
+            std::memcpy(inflated->data(), &view.header, sizeof(PacketHeader));
+            const size_t payloadSize = Network::LzCompression::decompress(
+                buffer->data() + sizeof(PacketHeader), buffer->size() - sizeof(PacketHeader),
+                inflated->data() + sizeof(PacketHeader), inflated->capacity() - sizeof(PacketHeader));
+            inflated->setSize(sizeof(PacketHeader) + payloadSize);
+            buffer = std::move(inflated); // The compressed datagram goes back to the pool
+        }
+
+        view.payload = Network::ByteSpan(buffer->data() + sizeof(PacketHeader), buffer->size() - sizeof(PacketHeader));
+        view.buffer_ = std::move(buffer);
+        return view;
+    }
+
+private:
+    Network::PacketRef buffer_;
+};
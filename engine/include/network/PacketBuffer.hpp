@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Network {
+
+    class PacketBufferPool;
+
+    /**
+     * @brief One datagram's worth of bytes, owned by a PacketBufferPool
+     *
+     * Only reachable through a PacketRef; goes back to its pool when the
+     * last reference is dropped.
+     */
+    class PacketBuffer {
+    public:
+        char* data() { return storage_.get(); }
+        const char* data() const { return storage_.get(); }
+        size_t capacity() const { return capacity_; }
+
+        // Bytes in use (the datagram length)
+        size_t size() const { return size_; }
+        void setSize(size_t size) {
+            if (size > capacity_) {
+                throw std::runtime_error("PacketBuffer: size exceeds capacity");
+            }
+            size_ = size;
+        }
+
+    private:
+        friend class PacketBufferPool;
+        friend class PacketRef;
+
+        PacketBuffer(size_t capacity, PacketBufferPool* pool)
+            : storage_(new char[capacity]), capacity_(capacity), pool_(pool) {}
+
+        std::unique_ptr<char[]> storage_;
+        size_t capacity_;
+        size_t size_ = 0;
+        std::atomic<uint32_t> refs_{0};
+        PacketBufferPool* pool_;
+    };
+
+    /**
+     * @brief Intrusive reference to a pooled PacketBuffer
+     *
+     * Copies share the buffer (an atomic increment, no allocation), so a
+     * packet can be queued, handed to the game thread and parsed without
+     * its bytes ever being copied. Empty when the pool was exhausted.
+     */
+    class PacketRef {
+    public:
+        PacketRef() = default;
+        PacketRef(const PacketRef& other) : buffer_(other.buffer_) {
+            if (buffer_) {
+                buffer_->refs_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        PacketRef(PacketRef&& other) noexcept : buffer_(std::exchange(other.buffer_, nullptr)) {}
+        ~PacketRef() { reset(); }
+
+        PacketRef& operator=(PacketRef other) noexcept {
+            std::swap(buffer_, other.buffer_);
+            return *this;
+        }
+
+        explicit operator bool() const { return buffer_ != nullptr; }
+        PacketBuffer* get() const { return buffer_; }
+        PacketBuffer* operator->() const { return buffer_; }
+        PacketBuffer& operator*() const { return *buffer_; }
+
+        inline void reset();
+
+    private:
+        friend class PacketBufferPool;
+
+        explicit PacketRef(PacketBuffer* buffer) : buffer_(buffer) {
+            buffer_->refs_.store(1, std::memory_order_relaxed);
+        }
+
+        PacketBuffer* buffer_ = nullptr;
+    };
+
+    /**
+     * @brief Bounded free list of datagram buffers, all of one size
+     *
+     * Buffers are created on demand up to maxBuffers, then recycled: once
+     * warm, acquiring and releasing never touch the heap. acquire() may be
+     * called from the I/O thread while references are dropped on the game
+     * thread. The pool must outlive every PacketRef it handed out.
+     */
+    class PacketBufferPool {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 65536; // Largest UDP payload
+        static constexpr size_t MTU_BUFFER_SIZE = 1500;      // Any datagram that is not IP-fragmented
+        static constexpr size_t DEFAULT_MAX_BUFFERS = 512;
+
+        explicit PacketBufferPool(size_t maxBuffers = DEFAULT_MAX_BUFFERS, size_t bufferSize = DEFAULT_BUFFER_SIZE)
+            : maxBuffers_(maxBuffers), bufferSize_(bufferSize) {
+            buffers_.reserve(maxBuffers);
+            free_.reserve(maxBuffers);
+        }
+
+        PacketBufferPool(const PacketBufferPool&) = delete;
+        PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+
+        // A buffer with size 0, or an empty ref when all maxBuffers are in use
+        PacketRef acquire() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            PacketBuffer* buffer = nullptr;
+            if (!free_.empty()) {
+                buffer = free_.back();
+                free_.pop_back();
+            } else if (buffers_.size() < maxBuffers_) {
+                buffers_.emplace_back(new PacketBuffer(bufferSize_, this));
+                buffer = buffers_.back().get();
+            } else {
+                return PacketRef();
+            }
+            buffer->size_ = 0;
+            return PacketRef(buffer);
+        }
+
+        size_t bufferSize() const { return bufferSize_; }
+
+        // Buffers currently referenced
+        size_t inUse() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return buffers_.size() - free_.size();
+        }
+
+    private:
+        friend class PacketRef;
+
+        void release(PacketBuffer* buffer) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(buffer);
+        }
+
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<PacketBuffer>> buffers_;
+        std::vector<PacketBuffer*> free_;
+        size_t maxBuffers_;
+        size_t bufferSize_;
+    };
+
+    inline void PacketRef::reset() {
+        if (buffer_ && buffer_->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            buffer_->pool_->release(buffer_);
+        }
+        buffer_ = nullptr;
+    }
+
+}
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <stdexcept>
 #include <type_traits>
+#include "ByteSpan.hpp"
 
 namespace Network {
 
@@ -41,10 +42,12 @@ namespace Network {
         std::vector<char> buffer_;
     };
 
+    // Reads in place: the bytes must outlive the Deserializer
     class Deserializer {
     public:
-        Deserializer(const std::vector<char>& data) : buffer_(data), offset_(0) {}
-        Deserializer(const char* data, size_t size) : buffer_(data, data + size), offset_(0) {}
+        Deserializer(ByteSpan data) : buffer_(data), offset_(0) {}
+        Deserializer(const char* data, size_t size) : buffer_(data, size), offset_(0) {}
+        Deserializer(std::vector<char>&&) = delete; // Would dangle
 
         // Read a POD type
         template <typename T>
@@ -86,7 +89,7 @@ namespace Network {
         }
 
     private:
-        std::vector<char> buffer_;
+        ByteSpan buffer_;
         size_t offset_;
     };
 
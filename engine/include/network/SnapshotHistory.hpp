@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Network {
+
+    /**
+     * @brief Ring of the last Capacity world snapshots, looked up by sequence
+     *
+     * Both ends of a delta-compressed snapshot stream keep one: the server
+     * to diff against the snapshot a client acknowledged, the client to
+     * rebuild full state on top of the baseline a delta refers to. States
+     * are kept sorted by id so two snapshots are diffed with a single
+     * merge pass. Slots are reused, so storing does not allocate once warm.
+     */
+    template <typename State, std::size_t Capacity = 32>
+    class SnapshotHistory {
+    public:
+        // Stores the entities of snapshot `seq`, overwriting the oldest slot
+        template <typename Iterator>
+        void store(uint32_t seq, Iterator first, Iterator last) {
+            Slot& slot = slots_[seq % Capacity];
+            slot.seq = seq;
+            slot.entities.assign(first, last);
+            std::sort(slot.entities.begin(), slot.entities.end(),
+                      [](const State& a, const State& b) { return a.id < b.id; });
+        }
+
+        void store(uint32_t seq, const std::vector<State>& entities) {
+            store(seq, entities.begin(), entities.end());
+        }
+
+        // Entities of snapshot `seq` sorted by id, or nullptr once it left the ring
+        const std::vector<State>* find(uint32_t seq) const {
+            if (seq == 0) {
+                return nullptr;
+            }
+            const Slot& slot = slots_[seq % Capacity];
+            return slot.seq == seq ? &slot.entities : nullptr;
+        }
+
+        void clear() {
+            for (auto& slot : slots_) {
+                slot.seq = 0;
+                slot.entities.clear();
+            }
+        }
+
+    private:
+        struct Slot {
+            uint32_t seq = 0;
+            std::vector<State> entities;
+        };
+
+        std::array<Slot, Capacity> slots_;
+    };
+
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Network {
+
+    // Snapshot of a queue's state, readable from any thread
+    struct QueueStats {
+        size_t depth = 0;     // Items waiting to be consumed
+        size_t capacity = 0;
+        uint64_t dropped = 0; // Items rejected since creation (queue full, no buffer left, send failed)
+    };
+
+    /**
+     * @brief Bounded lock-free queue for exactly one producer and one consumer thread
+     *
+     * Hands packets between the asio I/O thread and the game loop without
+     * a mutex: each side owns one index and only reads the other's, so
+     * neither ever waits for the other. Pushing into a full ring fails
+     * (and counts a drop) instead of blocking. The consumer drains in
+     * batches, publishing its progress once per batch.
+     *
+     * Slots are allocated once; moved-from items stay in their slot until
+     * overwritten, so T should release its resources when moved from
+     * (PacketView, PacketRef do).
+     */
+    template <typename T>
+    class SpscRing {
+    public:
+        // Capacity is rounded up to a power of two
+        explicit SpscRing(size_t capacity) : slots_(roundUp(capacity)), mask_(slots_.size() - 1) {}
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        // Producer only. False, and a drop counted, when the ring is full
+        bool tryPush(T&& item) {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - headCache_ == slots_.size()) {
+                headCache_ = head_.load(std::memory_order_acquire);
+                if (tail - headCache_ == slots_.size()) {
+                    recordDrop();
+                    return false;
+                }
+            }
+            slots_[tail & mask_] = std::move(item);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only
+        bool tryPop(T& out) {
+            return consume([&out](T&& item) { out = std::move(item); }, 1) == 1;
+        }
+
+        /**
+         * @brief Consumer only: moves up to `max` items, oldest first, into func(T&&)
+         *
+         * Everything pushed before the call is seen in one pass. func must
+         * not throw: the slots are released only once the batch is done.
+         * @return number of items consumed
+         */
+        template <typename Func>
+        size_t consume(Func&& func, size_t max = std::numeric_limits<size_t>::max()) {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            const size_t count = std::min(tail_.load(std::memory_order_acquire) - head, max);
+            for (size_t i = 0; i < count; ++i) {
+                func(std::move(slots_[(head + i) & mask_]));
+            }
+            head_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        // Consumer only: appends every waiting item to `out` (reuse it to avoid allocating)
+        size_t popBatch(std::vector<T>& out, size_t max = std::numeric_limits<size_t>::max()) {
+            return consume([&out](T&& item) { out.push_back(std::move(item)); }, max);
+        }
+
+        // For items lost before reaching the ring; safe from any thread
+        void recordDrop() {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Approximate from any thread, exact from either end
+        size_t size() const {
+            const size_t head = head_.load(std::memory_order_acquire);
+            return tail_.load(std::memory_order_acquire) - head;
+        }
+
+        size_t capacity() const {
+            return slots_.size();
+        }
+
+        QueueStats stats() const {
+            QueueStats stats;
+            stats.depth = size();
+            stats.capacity = capacity();
+            stats.dropped = dropped_.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+    private:
+        static constexpr size_t CACHE_LINE = 64;
+
+        static size_t roundUp(size_t capacity) {
+            size_t size = 1;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            return size;
+        }
+
+        std::vector<T> slots_;
+        size_t mask_;
+
+        // Each index on its own cache line, next to what its owner caches of the other
+        alignas(CACHE_LINE) std::atomic<size_t> head_{0}; // Written by the consumer
+        alignas(CACHE_LINE) std::atomic<size_t> tail_{0}; // Written by the producer
+        size_t headCache_ = 0;                             // Producer's last view of head_
+        alignas(CACHE_LINE) std::atomic<uint64_t> dropped_{0};
+    };
+
+    /**
+     * @brief Decides when an SpscRing's producer must wake the consumer
+     *
+     * The producer calls request() after each push and posts a drain when
+     * it returns true; the drain calls begin() before consuming. Each side
+     * fences between its store and its next load, so either the drain sees
+     * the push or request() sees the cleared flag and posts another drain:
+     * nothing is left in the ring with no drain coming.
+     */
+    class DrainSignal {
+    public:
+        // Producer, after pushing. True when the caller must post a drain
+        bool request() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return !scheduled_.exchange(true, std::memory_order_acq_rel);
+        }
+
+        // Consumer, before draining: what is pushed from now on posts again
+        void begin() {
+            scheduled_.store(false, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+    private:
+        std::atomic<bool> scheduled_{false};
+    };
+
+}
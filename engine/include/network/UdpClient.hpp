@@ -1,11 +1,12 @@
 #pragma once
 
 #include <asio.hpp>
+#include <atomic>
 #include <vector>
-#include <mutex>
-#include <queue>
 #include <iostream>
 #include "Packet.hpp"
+#include "PacketBuffer.hpp"
+#include "SpscRing.hpp"
 
 using asio::ip::udp;
 
@@ -18,11 +19,19 @@ public:
     void start();
 
     // Send a packet to the server
+    // Queued for the I/O thread (game thread only); a full queue drops it
     void send(const NetworkPacket& packet);
 
-    // Pop the next received packet from the queue (Thread-safe)
+    // Pop the next received packet from the queue (game thread only)
     // Returns true if a packet was retrieved, false if queue is empty
-    bool popPacket(NetworkPacket& outPacket);
+    // The view shares the pooled receive buffer: nothing is copied
+    bool popPacket(PacketView& outPacket);
+
+    // Appends every packet received so far to `out` in one pass (game thread only)
+    size_t popPackets(std::vector<PacketView>& out) { return inbound_.popBatch(out); }
+
+    Network::QueueStats getInboundStats() const { return inbound_.stats(); }
+    Network::QueueStats getOutboundStats() const { return outbound_.stats(); }
 
     // Close the socket (cancels all pending async operations)
     void close();
@@ -35,13 +44,35 @@ private:
     void handleReceive(const std::error_code& error, std::size_t bytes_transferred);
     void handleSend(const std::error_code& error, std::size_t bytes_transferred);
 
+    // Wakes the I/O thread to send what is queued, at most one wake-up pending
+    void scheduleFlush();
+    // I/O thread: sends everything queued
+    void flushOutbound();
+
+public:
+    // Packets waiting between the two threads; beyond that new ones are dropped
+    static constexpr size_t RECEIVE_QUEUE_CAPACITY = 256;
+    static constexpr size_t SEND_QUEUE_CAPACITY = 256;
+
 private:
     udp::socket socket_;
     udp::endpoint serverEndpoint_;
-    std::array<char, 65536> recvBuffer_;
+    udp::endpoint senderEndpoint_; // Written by receives, so serverEndpoint_ never changes
     bool connected_;
 
-    // Packet queue for Game Engine
-    std::queue<NetworkPacket> packetQueue_;
-    std::mutex queueMutex_;
+    // Datagrams are received straight into pooled buffers; when the pool
+    // is exhausted they land in overflowBuffer_ and are dropped. Snapshots
+    // can exceed one MTU, so these stay full size and also take inflation
+    Network::PacketBufferPool bufferPool_;
+    Network::PacketRef recvBuffer_;
+    std::array<char, 65536> overflowBuffer_;
+
+    // I/O thread -> game thread
+    Network::SpscRing<PacketView> inbound_{RECEIVE_QUEUE_CAPACITY};
+
+    // Game thread -> I/O thread
+    // Inputs and control messages fit one MTU; a larger datagram is dropped
+    Network::PacketBufferPool sendPool_{SEND_QUEUE_CAPACITY, Network::PacketBufferPool::MTU_BUFFER_SIZE};
+    Network::SpscRing<Network::PacketRef> outbound_{SEND_QUEUE_CAPACITY};
+    Network::DrainSignal flushSignal_;
 };
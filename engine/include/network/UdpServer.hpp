@@ -1,12 +1,14 @@
 #pragma once
 
 #include <asio.hpp>
+#include <atomic>
 #include <vector>
 #include <map>
 #include <mutex>
 #include <iostream>
-#include <queue>
 #include "Packet.hpp"
+#include "PacketBuffer.hpp"
+#include "SpscRing.hpp"
 #include "ClientSession.hpp"
 // Removed: "GameProtocol.hpp" - Engine should not depend on game-specific protocol
 
@@ -20,16 +22,24 @@ public:
     // Start receiving packets
     void start();
 
-    // Pop the next valid packet from the queue (Thread-safe)
+    // Pop the next valid packet from the queue (game thread only)
     // Returns true if a packet was retrieved, false if queue is empty
-    bool popPacket(NetworkPacket& outPacket, udp::endpoint& outSender);
+    // The view shares the pooled receive buffer: nothing is copied
+    bool popPacket(PacketView& outPacket, udp::endpoint& outSender);
+
+    // Appends every packet received so far to `out` in one pass (game thread only)
+    size_t popPackets(std::vector<std::pair<PacketView, udp::endpoint>>& out);
 
     // Broadcast a packet to all connected clients
+    // Sends are queued for the I/O thread (game thread only); a full queue drops them
     void broadcast(const NetworkPacket& packet);
 
     // Send to specific client
     void sendTo(const NetworkPacket& packet, const udp::endpoint& endpoint);
 
+    Network::QueueStats getInboundStats() const { return inbound_.stats(); }
+    Network::QueueStats getOutboundStats() const { return outbound_.stats(); }
+
     // Check for timeouts and remove inactive clients
     void checkTimeouts();
     
@@ -41,20 +51,52 @@ private:
     void startReceive();
     void handleReceive(const std::error_code& error, std::size_t bytes_transferred);
     
-    // Internal helper to get or create session
-    void handleClientSession(const udp::endpoint& sender, const NetworkPacket& packet);
+    // Internal helper to get or create session (game thread, as packets are popped)
+    void handleClientSession(const udp::endpoint& sender, const PacketHeader& header);
+
+    // Serializes into a pooled buffer, MTU-sized unless the packet needs more; empty when none is left
+    Network::PacketRef serializeForSend(const NetworkPacket& packet);
+    // Wakes the I/O thread to send what is queued, at most one wake-up pending
+    void scheduleFlush();
+    // I/O thread: sends everything queued
+    void flushOutbound();
+
+public:
+    // Packets waiting between the two threads; beyond that new ones are dropped
+    static constexpr size_t RECEIVE_QUEUE_CAPACITY = 256;
+    static constexpr size_t SEND_QUEUE_CAPACITY = 1024;
+    // Full-size buffers, for snapshots over one MTU and for inflating compressed datagrams
+    static constexpr size_t LARGE_BUFFERS = 16;
 
 private:
     udp::socket socket_;
     udp::endpoint receiverEndpoint_;
-    std::array<char, 65536> recvBuffer_;
+
+    // Datagrams are received straight into pooled buffers; when the pool
+    // is exhausted they land in overflowBuffer_ and are dropped. Clients
+    // only send inputs and control messages, well under one MTU, so a
+    // datagram that fills its buffer may be truncated and is dropped too
+    Network::PacketBufferPool bufferPool_{Network::PacketBufferPool::DEFAULT_MAX_BUFFERS,
+                                          Network::PacketBufferPool::MTU_BUFFER_SIZE};
+    Network::PacketBufferPool inflatePool_{LARGE_BUFFERS};
+    Network::PacketRef recvBuffer_;
+    std::array<char, Network::PacketBufferPool::MTU_BUFFER_SIZE> overflowBuffer_;
 
     // Client management
-    std::map<std::string, std::shared_ptr<ClientSession>> sessions_; // Key: "IP:Port"
+    std::map<udp::endpoint, std::shared_ptr<ClientSession>> sessions_;
     mutable std::mutex sessionsMutex_;  // mutable to allow const methods to lock
     uint8_t nextPlayerId_ = 1;
 
-    // Packet queue for Game Engine
-    std::queue<std::pair<NetworkPacket, udp::endpoint>> packetQueue_;
-    mutable std::mutex queueMutex_;  // mutable to allow const methods to lock
+    // I/O thread -> game thread
+    Network::SpscRing<std::pair<PacketView, udp::endpoint>> inbound_{RECEIVE_QUEUE_CAPACITY};
+
+    // Game thread -> I/O thread; a broadcast shares one buffer between its entries
+    struct OutgoingPacket {
+        Network::PacketRef buffer;
+        udp::endpoint endpoint;
+    };
+    Network::PacketBufferPool sendPool_{SEND_QUEUE_CAPACITY, Network::PacketBufferPool::MTU_BUFFER_SIZE};
+    Network::PacketBufferPool largeSendPool_{LARGE_BUFFERS};
+    Network::SpscRing<OutgoingPacket> outbound_{SEND_QUEUE_CAPACITY};
+    Network::DrainSignal flushSignal_;
 };
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef ENG_ENGINE_PHYSICS_AABB_HPP
+#define ENG_ENGINE_PHYSICS_AABB_HPP
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace physics
+        {
+
+            /**
+             * @brief Axis-aligned box in world space (min inclusive, max exclusive for overlap)
+             */
+            struct Aabb {
+                float minX = 0.0f;
+                float minY = 0.0f;
+                float maxX = 0.0f;
+                float maxY = 0.0f;
+            };
+
+            // Same strict test the collision code always used: touching edges do not overlap
+            inline bool overlaps(const Aabb& a, const Aabb& b)
+            {
+                return a.minX < b.maxX && a.maxX > b.minX &&
+                       a.minY < b.maxY && a.maxY > b.minY;
+            }
+
+        }
+    }
+}
+
+#endif // ENG_ENGINE_PHYSICS_AABB_HPP
@@ -0,0 +1,212 @@
+#ifndef ENG_ENGINE_PHYSICS_AABBBATCH_HPP
+#define ENG_ENGINE_PHYSICS_AABBBATCH_HPP
+
+#include "Aabb.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define ENG_PHYSICS_SIMD_AVX 1
+    #define ENG_PHYSICS_SIMD_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ENG_PHYSICS_SIMD_SSE2 1
+#endif
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace physics
+        {
+
+            /**
+             * @brief Boxes stored as separate extent arrays, ready for lane-wise tests
+             *
+             * Layer and mask ride along so the layer filter is applied in the
+             * same pass as the overlap test.
+             */
+            struct AabbSoA {
+                std::vector<float> minX;
+                std::vector<float> minY;
+                std::vector<float> maxX;
+                std::vector<float> maxY;
+                std::vector<std::uint32_t> layer;
+                std::vector<std::uint32_t> mask;
+
+                std::size_t size() const { return minX.size(); }
+
+                void clear()
+                {
+                    minX.clear();
+                    minY.clear();
+                    maxX.clear();
+                    maxY.clear();
+                    layer.clear();
+                    mask.clear();
+                }
+
+                void reserve(std::size_t count)
+                {
+                    minX.reserve(count);
+                    minY.reserve(count);
+                    maxX.reserve(count);
+                    maxY.reserve(count);
+                    layer.reserve(count);
+                    mask.reserve(count);
+                }
+
+                void push_back(const Aabb& box, std::uint32_t layerBits = ~0u, std::uint32_t maskBits = ~0u)
+                {
+                    minX.push_back(box.minX);
+                    minY.push_back(box.minY);
+                    maxX.push_back(box.maxX);
+                    maxY.push_back(box.maxY);
+                    layer.push_back(layerBits);
+                    mask.push_back(maskBits);
+                }
+            };
+
+            // Instruction set the batch kernel was compiled for
+            inline const char* batchKernelName()
+            {
+#if defined(ENG_PHYSICS_SIMD_AVX)
+                return "avx";
+#elif defined(ENG_PHYSICS_SIMD_SSE2)
+                return "sse2";
+#else
+                return "scalar";
+#endif
+            }
+
+            namespace detail
+            {
+#if defined(ENG_PHYSICS_SIMD_SSE2)
+                // 4-bit lane mask of candidates whose layer filter accepts the query
+                // (integer ops: layer bits reinterpreted as floats would be denormals)
+                inline int acceptedLanes(__m128i qLayer, __m128i qMask, const std::uint32_t* masks, const std::uint32_t* layers)
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i layerZero = _mm_cmpeq_epi32(
+                        _mm_and_si128(qLayer, _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks))), zero);
+                    const __m128i maskZero = _mm_cmpeq_epi32(
+                        _mm_and_si128(qMask, _mm_loadu_si128(reinterpret_cast<const __m128i*>(layers))), zero);
+                    return ~_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(layerZero, maskZero))) & 0xF;
+                }
+#endif
+
+                inline std::size_t popcount(unsigned bits)
+                {
+                    std::size_t count = 0;
+                    for (; bits != 0; bits &= bits - 1) {
+                        ++count;
+                    }
+                    return count;
+                }
+
+                // Appends first + lane for every set lane, in lane order, without branches
+                inline std::size_t compact(unsigned bits, unsigned lanes, std::size_t first, std::uint32_t* hits)
+                {
+                    std::size_t count = 0;
+                    for (unsigned lane = 0; lane < lanes; ++lane) {
+                        hits[count] = static_cast<std::uint32_t>(first + lane);
+                        count += (bits >> lane) & 1u;
+                    }
+                    return count;
+                }
+            }
+
+            /**
+             * @brief Scalar reference: tests `box` against others[first, last)
+             *
+             * Writes the index of every box that overlaps it and whose layer
+             * filter accepts it to `hits`, which must hold last - first
+             * entries. Adds the number of layer-accepted candidates (box
+             * tests) to `tests`.
+             * @return number of hits written
+             */
+            inline std::size_t overlapOneVsManyScalar(const Aabb& box, std::uint32_t layer, std::uint32_t mask,
+                const AabbSoA& others, std::size_t first, std::size_t last, std::uint32_t* hits, std::size_t& tests)
+            {
+                std::size_t count = 0;
+                for (std::size_t i = first; i < last; ++i) {
+                    if ((layer & others.mask[i]) == 0 || (others.layer[i] & mask) == 0) {
+                        continue;
+                    }
+                    ++tests;
+                    // Branchless store: the slot is only kept when the boxes overlap
+                    hits[count] = static_cast<std::uint32_t>(i);
+                    count += (box.minX < others.maxX[i]) & (box.maxX > others.minX[i]) &
+                             (box.minY < others.maxY[i]) & (box.maxY > others.minY[i]);
+                }
+                return count;
+            }
+
+            /**
+             * @brief overlapOneVsManyScalar, 8 (AVX) or 4 (SSE2) candidates per instruction
+             *
+             * Same contract and same results, in the same order, as the scalar
+             * version; the remainder of the range goes through the scalar path.
+             */
+            inline std::size_t overlapOneVsMany(const Aabb& box, std::uint32_t layer, std::uint32_t mask,
+                const AabbSoA& others, std::size_t first, std::size_t last, std::uint32_t* hits, std::size_t& tests)
+            {
+                std::size_t count = 0;
+                std::size_t i = first;
+
+#if defined(ENG_PHYSICS_SIMD_AVX)
+                const __m256 qMinX = _mm256_set1_ps(box.minX);
+                const __m256 qMinY = _mm256_set1_ps(box.minY);
+                const __m256 qMaxX = _mm256_set1_ps(box.maxX);
+                const __m256 qMaxY = _mm256_set1_ps(box.maxY);
+                const __m128i qLayer = _mm_set1_epi32(static_cast<int>(layer));
+                const __m128i qMask = _mm_set1_epi32(static_cast<int>(mask));
+                for (; i + 8 <= last; i += 8) {
+                    const int accepted = detail::acceptedLanes(qLayer, qMask, &others.mask[i], &others.layer[i]) |
+                                         (detail::acceptedLanes(qLayer, qMask, &others.mask[i + 4], &others.layer[i + 4]) << 4);
+                    if (accepted == 0) {
+                        continue;
+                    }
+                    tests += detail::popcount(static_cast<unsigned>(accepted));
+
+                    __m256 overlap = _mm256_cmp_ps(qMinX, _mm256_loadu_ps(&others.maxX[i]), _CMP_LT_OQ);
+                    overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(qMaxX, _mm256_loadu_ps(&others.minX[i]), _CMP_GT_OQ));
+                    overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(qMinY, _mm256_loadu_ps(&others.maxY[i]), _CMP_LT_OQ));
+                    overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(qMaxY, _mm256_loadu_ps(&others.minY[i]), _CMP_GT_OQ));
+                    const unsigned bits = static_cast<unsigned>(_mm256_movemask_ps(overlap) & accepted);
+                    if (bits != 0) {
+                        count += detail::compact(bits, 8, i, hits + count);
+                    }
+                }
+#elif defined(ENG_PHYSICS_SIMD_SSE2)
+                const __m128 qMinX = _mm_set1_ps(box.minX);
+                const __m128 qMinY = _mm_set1_ps(box.minY);
+                const __m128 qMaxX = _mm_set1_ps(box.maxX);
+                const __m128 qMaxY = _mm_set1_ps(box.maxY);
+                const __m128i qLayer = _mm_set1_epi32(static_cast<int>(layer));
+                const __m128i qMask = _mm_set1_epi32(static_cast<int>(mask));
+                for (; i + 4 <= last; i += 4) {
+                    const int accepted = detail::acceptedLanes(qLayer, qMask, &others.mask[i], &others.layer[i]);
+                    if (accepted == 0) {
+                        continue;
+                    }
+                    tests += detail::popcount(static_cast<unsigned>(accepted));
+
+                    __m128 overlap = _mm_cmplt_ps(qMinX, _mm_loadu_ps(&others.maxX[i]));
+                    overlap = _mm_and_ps(overlap, _mm_cmpgt_ps(qMaxX, _mm_loadu_ps(&others.minX[i])));
+                    overlap = _mm_and_ps(overlap, _mm_cmplt_ps(qMinY, _mm_loadu_ps(&others.maxY[i])));
+                    overlap = _mm_and_ps(overlap, _mm_cmpgt_ps(qMaxY, _mm_loadu_ps(&others.minY[i])));
+                    count += detail::compact(static_cast<unsigned>(_mm_movemask_ps(overlap) & accepted), 4, i, hits + count);
+                }
+#endif
+
+                return count + overlapOneVsManyScalar(box, layer, mask, others, i, last, hits + count, tests);
+            }
+
+        }
+    }
+}
+
+#endif // ENG_ENGINE_PHYSICS_AABBBATCH_HPP
@@ -0,0 +1,111 @@
+#ifndef ENG_ENGINE_PHYSICS_COLLISIONLAYERS_HPP
+#define ENG_ENGINE_PHYSICS_COLLISIONLAYERS_HPP
+
+#include <components/Collider.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace physics
+        {
+
+            /**
+             * @brief Maps collider tags to layer bits and holds the layer collision matrix
+             *
+             * Each distinct tag gets one of 32 layer bits on first use. Bit 0 is
+             * reserved for the "default" tag, the layer of a Collider nobody
+             * assigned, and it collides with everything. Other rules are
+             * symmetric and start empty: a registered layer collides with
+             * the default layer only until setCollides() pairs it with
+             * another one. assign() resolves a tag once, when the collider
+             * is created, so the broad phase only compares integers.
+             *
+             *   layers.setCollides("player", "enemy");
+             *   layers.setCollides("player_projectile", "enemy");
+             *   layers.assign(collider, "player");
+             */
+            class CollisionLayerTable {
+                public:
+                    static constexpr std::size_t MaxLayers = 32;
+                    static constexpr std::uint32_t DefaultLayer = 1u; // Collider::layer when never assigned
+
+                    CollisionLayerTable()
+                    {
+                        layers_.emplace("default", DefaultLayer);
+                        masks_[index(DefaultLayer)] = 0xFFFFFFFFu;
+                    }
+
+                    // Layer bit of a tag, registering it if needed
+                    std::uint32_t layer(const std::string& tag)
+                    {
+                        auto it = layers_.find(tag);
+                        if (it != layers_.end()) {
+                            return it->second;
+                        }
+                        if (layers_.size() >= MaxLayers) {
+                            throw std::runtime_error("Too many collision layers (max 32), cannot add '" + tag + "'.");
+                        }
+                        const std::uint32_t bit = 1u << layers_.size();
+                        layers_.emplace(tag, bit);
+                        masks_[index(bit)] = DefaultLayer;
+                        return bit;
+                    }
+
+                    // Layers the tag's colliders collide with
+                    std::uint32_t mask(const std::string& tag)
+                    {
+                        return masks_[index(layer(tag))];
+                    }
+
+                    void setCollides(const std::string& a, const std::string& b, bool collides = true)
+                    {
+                        const std::uint32_t layerA = layer(a);
+                        const std::uint32_t layerB = layer(b);
+                        if (collides) {
+                            masks_[index(layerA)] |= layerB;
+                            masks_[index(layerB)] |= layerA;
+                        } else {
+                            masks_[index(layerA)] &= ~layerB;
+                            masks_[index(layerB)] &= ~layerA;
+                        }
+                    }
+
+                    bool collides(const std::string& a, const std::string& b)
+                    {
+                        return (mask(a) & layer(b)) != 0;
+                    }
+
+                    // Sets tag, layer and mask of a collider about to be added
+                    void assign(Collider& collider, const std::string& tag)
+                    {
+                        collider.tag = tag;
+                        collider.layer = layer(tag);
+                        collider.mask = mask(tag);
+                    }
+
+                private:
+                    static std::size_t index(std::uint32_t bit)
+                    {
+                        std::size_t i = 0;
+                        while ((bit >> i) != 1u) {
+                            ++i;
+                        }
+                        return i;
+                    }
+
+                    std::unordered_map<std::string, std::uint32_t> layers_;
+                    std::array<std::uint32_t, MaxLayers> masks_{};
+            };
+
+        }
+    }
+}
+
+#endif // ENG_ENGINE_PHYSICS_COLLISIONLAYERS_HPP
@@ -0,0 +1,324 @@
+#ifndef ENG_ENGINE_PHYSICS_SPATIALHASH_HPP
+#define ENG_ENGINE_PHYSICS_SPATIALHASH_HPP
+
+#include "AabbBatch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace physics
+        {
+
+            /**
+             * @brief Uniform-grid broad phase over a hashed, unbounded set of cells
+             *
+             * Items are small integers (indices into the caller's arrays) with a
+             * box each. build() buckets every (cell, item) entry with a counting
+             * sort on the cell hash, so a rebuild is linear and reuses the
+             * buffers of the previous frame. forEachPair() only tests items
+             * sharing a cell and reports each overlapping pair exactly once: in
+             * the cell holding the min corner of the pair's intersection.
+             *
+             * Items spanning more than maxCellsPerItem cells (backgrounds, beams)
+             * are kept aside and tested against everything instead of flooding
+             * the grid.
+             *
+             * Each item may carry a layer bit and a mask of accepted layers;
+             * pairs whose layers do not accept each other are rejected before
+             * any box test and never reported.
+             *
+             * Boxes are kept as SoA extents (also copied in bucket order by
+             * build()), so every item is tested against the rest of its bucket
+             * with the overlapOneVsMany SIMD kernel.
+             *
+             *   grid.clear();
+             *   for (i...) grid.insert(box[i]);   // item i
+             *   grid.build();
+             *   grid.forEachPair([](std::uint32_t a, std::uint32_t b) { ... });
+             */
+            class SpatialHash {
+                public:
+                    explicit SpatialHash(float cellSize = 128.0f, std::size_t maxCellsPerItem = 16)
+                        : maxCellsPerItem_(maxCellsPerItem)
+                    {
+                        setCellSize(cellSize);
+                    }
+
+                    void setCellSize(float cellSize)
+                    {
+                        cellSize_ = cellSize > 0.0f ? cellSize : 1.0f;
+                        inverseCellSize_ = 1.0f / cellSize_;
+                    }
+                    float getCellSize() const { return cellSize_; }
+
+                    // Forget all items, keeping the allocated buffers
+                    void clear()
+                    {
+                        items_.clear();
+                        entries_.clear();
+                        oversized_.clear();
+                        oversizedFlags_.clear();
+                        built_ = false;
+                    }
+
+                    // Adds an item; its index is the number of items inserted before it
+                    std::uint32_t insert(const Aabb& box, std::uint32_t layer = ~0u, std::uint32_t mask = ~0u)
+                    {
+                        const auto item = static_cast<std::uint32_t>(items_.size());
+                        items_.push_back(box, layer, mask);
+
+                        const CellRange range = cellRange(box);
+                        const bool oversized = cellCount(range) > maxCellsPerItem_;
+                        oversizedFlags_.push_back(oversized);
+                        if (oversized) {
+                            oversized_.push_back(item);
+                        } else {
+                            for (std::int32_t cy = range.y0; cy <= range.y1; ++cy) {
+                                for (std::int32_t cx = range.x0; cx <= range.x1; ++cx) {
+                                    entries_.push_back(Entry{cellKey(cx, cy), item});
+                                }
+                            }
+                        }
+                        built_ = false;
+                        return item;
+                    }
+
+                    std::size_t size() const { return items_.size(); }
+                    Aabb box(std::uint32_t item) const
+                    {
+                        return Aabb{items_.minX[item], items_.minY[item], items_.maxX[item], items_.maxY[item]};
+                    }
+
+                    // Buckets the entries by cell hash (counting sort, no allocation once warm)
+                    void build()
+                    {
+                        std::size_t bucketCount = 16;
+                        while (bucketCount < entries_.size() * 2) {
+                            bucketCount <<= 1;
+                        }
+                        bucketShift_ = 64 - log2(bucketCount);
+
+                        bucketStarts_.assign(bucketCount + 1, 0);
+                        for (const Entry& entry : entries_) {
+                            ++bucketStarts_[bucket(entry.cell) + 1];
+                        }
+                        for (std::size_t i = 1; i <= bucketCount; ++i) {
+                            bucketStarts_[i] += bucketStarts_[i - 1];
+                        }
+
+                        sorted_.resize(entries_.size());
+                        cursor_.assign(bucketStarts_.begin(), bucketStarts_.end() - 1);
+                        for (const Entry& entry : entries_) {
+                            sorted_[cursor_[bucket(entry.cell)]++] = entry;
+                        }
+
+                        // Extents in bucket order, contiguous for the batch kernel
+                        sortedItems_.clear();
+                        for (const Entry& entry : sorted_) {
+                            sortedItems_.push_back(box(entry.item), items_.layer[entry.item], items_.mask[entry.item]);
+                        }
+                        std::size_t longest = oversized_.empty() ? 0 : items_.size();
+                        for (std::size_t b = 0; b < bucketCount; ++b) {
+                            longest = std::max(longest, bucketStarts_[b + 1] - bucketStarts_[b]);
+                        }
+                        hits_.resize(longest);
+                        built_ = true;
+                    }
+
+                    /**
+                     * @brief Calls func(a, b) once per overlapping pair, a < b
+                     *
+                     * Order follows the hash buckets; callers needing a stable
+                     * order collect and sort the pairs.
+                     * @return number of narrow-phase tests performed
+                     */
+                    template<typename Func>
+                    std::size_t forEachPair(Func&& func)
+                    {
+                        if (!built_) {
+                            build();
+                        }
+
+                        std::size_t tests = 0;
+                        const std::size_t bucketCount = bucketStarts_.size() - 1;
+                        for (std::size_t b = 0; b < bucketCount; ++b) {
+                            const std::size_t begin = bucketStarts_[b];
+                            const std::size_t end = bucketStarts_[b + 1];
+                            for (std::size_t i = begin; i + 1 < end; ++i) {
+                                const Entry& first = sorted_[i];
+                                const Aabb a = box(first.item);
+                                const std::size_t hitCount = overlapOneVsMany(a, items_.layer[first.item], items_.mask[first.item],
+                                    sortedItems_, i + 1, end, hits_.data(), tests);
+                                for (std::size_t h = 0; h < hitCount; ++h) {
+                                    const Entry& second = sorted_[hits_[h]];
+                                    // Hash collision between distinct cells
+                                    if (second.cell != first.cell) {
+                                        continue;
+                                    }
+                                    // Report in one cell only
+                                    const Aabb c = box(second.item);
+                                    if (cellKey(cellOf(std::max(a.minX, c.minX)), cellOf(std::max(a.minY, c.minY))) != first.cell) {
+                                        continue;
+                                    }
+                                    func(std::min(first.item, second.item), std::max(first.item, second.item));
+                                }
+                            }
+                        }
+
+                        // Oversized items against everything (each pair once)
+                        for (const std::uint32_t big : oversized_) {
+                            const std::size_t hitCount = overlapOneVsMany(box(big), items_.layer[big], items_.mask[big],
+                                items_, 0, items_.size(), hits_.data(), tests);
+                            for (std::size_t h = 0; h < hitCount; ++h) {
+                                const std::uint32_t other = hits_[h];
+                                if (other == big || (oversizedFlags_[other] && other < big)) {
+                                    continue;
+                                }
+                                func(std::min(big, other), std::max(big, other));
+                            }
+                        }
+                        return tests;
+                    }
+
+                    /**
+                     * @brief Calls func(item) once per item whose box overlaps `region`
+                     *
+                     * Only the cells under the region are visited, so this is
+                     * the tool for "what is near this point" queries (targets
+                     * in a radius, hits for one projectile) against a grid
+                     * built once per frame.
+                     */
+                    template<typename Func>
+                    void query(const Aabb& region, Func&& func)
+                    {
+                        if (!built_) {
+                            build();
+                        }
+
+                        const CellRange range = cellRange(region);
+                        // A region wider than the grid's content: a plain scan is cheaper
+                        if (cellCount(range) > entries_.size()) {
+                            for (std::uint32_t item = 0; item < items_.size(); ++item) {
+                                if (overlaps(region, box(item))) {
+                                    func(item);
+                                }
+                            }
+                            return;
+                        }
+
+                        for (std::int32_t cy = range.y0; cy <= range.y1; ++cy) {
+                            for (std::int32_t cx = range.x0; cx <= range.x1; ++cx) {
+                                const std::uint64_t key = cellKey(cx, cy);
+                                const std::size_t b = bucket(key);
+                                for (std::size_t i = bucketStarts_[b]; i < bucketStarts_[b + 1]; ++i) {
+                                    if (sorted_[i].cell != key) {
+                                        continue;
+                                    }
+                                    const std::uint32_t item = sorted_[i].item;
+                                    const Aabb candidate = box(item);
+                                    // Items spanning several cells are reported from one of them only
+                                    if (!overlaps(region, candidate) ||
+                                        cellKey(cellOf(std::max(region.minX, candidate.minX)),
+                                                cellOf(std::max(region.minY, candidate.minY))) != key) {
+                                        continue;
+                                    }
+                                    func(item);
+                                }
+                            }
+                        }
+                        for (const std::uint32_t big : oversized_) {
+                            if (overlaps(region, box(big))) {
+                                func(big);
+                            }
+                        }
+                    }
+
+                private:
+                    struct Entry {
+                        std::uint64_t cell;
+                        std::uint32_t item;
+                    };
+
+                    struct CellRange {
+                        std::int32_t x0, y0, x1, y1;
+                    };
+
+                    // Far-away or non-finite coordinates clamp to the border cells
+                    std::int32_t cellOf(float value) const
+                    {
+                        constexpr float limit = static_cast<float>(1 << 30);
+                        const float cell = std::floor(value * inverseCellSize_);
+                        if (!(cell > -limit)) {
+                            return -(1 << 30);
+                        }
+                        if (!(cell < limit)) {
+                            return 1 << 30;
+                        }
+                        return static_cast<std::int32_t>(cell);
+                    }
+
+                    CellRange cellRange(const Aabb& box) const
+                    {
+                        const std::int32_t x0 = cellOf(box.minX);
+                        const std::int32_t y0 = cellOf(box.minY);
+                        return CellRange{x0, y0, std::max(x0, cellOf(box.maxX)), std::max(y0, cellOf(box.maxY))};
+                    }
+
+                    // Clamped ranges span up to 2^31 + 1 cells per axis: count in 64 bits
+                    static std::uint64_t cellCount(const CellRange& range)
+                    {
+                        const std::int64_t width = static_cast<std::int64_t>(range.x1) - range.x0 + 1;
+                        const std::int64_t height = static_cast<std::int64_t>(range.y1) - range.y0 + 1;
+                        return static_cast<std::uint64_t>(width) * static_cast<std::uint64_t>(height);
+                    }
+
+                    static std::uint64_t cellKey(std::int32_t cx, std::int32_t cy)
+                    {
+                        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+                               static_cast<std::uint32_t>(cy);
+                    }
+
+                    std::size_t bucket(std::uint64_t cell) const
+                    {
+                        // Fibonacci hashing: top bits of the product
+                        return static_cast<std::size_t>((cell * 0x9E3779B97F4A7C15ull) >> bucketShift_);
+                    }
+
+                    static unsigned log2(std::size_t powerOfTwo)
+                    {
+                        unsigned bits = 0;
+                        while ((std::size_t(1) << bits) < powerOfTwo) {
+                            ++bits;
+                        }
+                        return bits;
+                    }
+
+                    float cellSize_ = 128.0f;
+                    float inverseCellSize_ = 1.0f / 128.0f;
+                    std::size_t maxCellsPerItem_;
+                    unsigned bucketShift_ = 60;
+                    bool built_ = false;
+
+                    AabbSoA items_;
+                    AabbSoA sortedItems_;
+                    std::vector<std::uint32_t> hits_;
+                    std::vector<Entry> entries_;
+                    std::vector<Entry> sorted_;
+                    std::vector<std::size_t> bucketStarts_;
+                    std::vector<std::size_t> cursor_;
+                    std::vector<std::uint32_t> oversized_;
+                    std::vector<bool> oversizedFlags_;
+            };
+
+        }
+    }
+}
+
+#endif // ENG_ENGINE_PHYSICS_SPATIALHASH_HPP
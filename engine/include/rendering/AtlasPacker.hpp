@@ -0,0 +1,63 @@
+#ifndef ENG_ENGINE_RENDERING_ATLASPACKER_HPP
+#define ENG_ENGINE_RENDERING_ATLASPACKER_HPP
+
+#include "rendering/Types.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+
+            /**
+             * @brief Skyline bottom-left rectangle packer for texture atlases
+             *
+             * Keeps the top outline of the packed area as a list of horizontal
+             * segments and puts each new rectangle where its top edge ends up
+             * lowest. Packing is online: rectangles are placed as they arrive
+             * and never moved, so regions handed out stay valid while more
+             * images are added to the same page. Sorting a known set by
+             * decreasing height first gives a tighter fit.
+             *
+             * `padding` empty pixels are kept right of and below every
+             * rectangle so neighbouring images never bleed into each other.
+             */
+            class AtlasPacker {
+                public:
+                    AtlasPacker(uint32_t width, uint32_t height, uint32_t padding = 1);
+
+                    // Forgets every placed rectangle
+                    void reset();
+
+                    // Places a width x height rectangle; false when the page has no room left
+                    bool pack(uint32_t width, uint32_t height, IntRect &out);
+
+                    Vector2u getSize() const { return Vector2u(width_, height_); }
+                    // Fraction of the page covered by packed rectangles (padding excluded)
+                    float getOccupancy() const;
+
+                private:
+                    struct Segment {
+                        uint32_t x;
+                        uint32_t y;
+                        uint32_t width;
+                    };
+
+                    // Lowest y at which a rectangle `width` wide fits from segment `index`, or false
+                    bool fits(std::size_t index, uint32_t width, uint32_t height, uint32_t &y) const;
+
+                    uint32_t width_;
+                    uint32_t height_;
+                    uint32_t padding_;
+                    uint64_t usedArea_ = 0;
+                    std::vector<Segment> skyline_;
+            };
+
+        }
+    }
+}
+
+#endif // ENG_ENGINE_RENDERING_ATLASPACKER_HPP
@@ -22,11 +22,14 @@ namespace eng
 
                     void setPosition(Vector2f position);
                     void setZoom(float zoom);
+                    void setViewport(IntRect viewport);
                     Vector2f worldToScreen(Vector2f worldPos) const;
                     Vector2f screenToWorld(Vector2f screenPos) const;
                     Vector2f getPosition() const { return position_; }
                     float getZoom() const { return zoom_; }
                     IntRect getViewport() const { return viewport_; }
+                    // World-space rectangle shown by the camera (centered on its position)
+                    FloatRect getVisibleArea() const;
                 };
 
         }
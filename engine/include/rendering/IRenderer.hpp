@@ -23,6 +23,27 @@ namespace eng
                     virtual void drawRect(const FloatRect &rect, uint32_t fillColor, uint32_t outlineColor = 0, float outlineThickness = 0.0f) = 0;
                     virtual void display() = 0;
                     virtual void setCamera(const Camera &camera) = 0;
+
+                    /**
+                     * @brief Queues a sprite to be drawn at the next flush()
+                     *
+                     * Backends that batch group queued sprites by layer and
+                     * texture: lower layers are drawn first, and sprites of one
+                     * layer sharing a texture go out in a single draw call.
+                     * `textureRect` is the part of the texture to show, applied
+                     * when the sprite is batched; an empty rect keeps the
+                     * sprite's own. The default draws immediately.
+                     */
+                    virtual void submit(ISprite &sprite, const Transform &transform, int layer, const IntRect &textureRect = IntRect())
+                    {
+                        (void)layer;
+                        if (textureRect.width != 0 || textureRect.height != 0) {
+                            sprite.setTextureRect(textureRect);
+                        }
+                        draw(sprite, transform);
+                    }
+                    // Draws everything queued by submit()
+                    virtual void flush() {}
             };
 
         }
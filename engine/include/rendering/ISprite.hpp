@@ -16,6 +16,10 @@ namespace eng
                     virtual void setTexture(ITexture *texture) = 0;
                     virtual void setPosition(Vector2f position) = 0;
                     virtual void setTextureRect(IntRect rect) = 0;
+                    // Texture the sprite samples, if the backend tracks it (used to group draws)
+                    virtual const ITexture *getTexture() const { return nullptr; }
+                    // Rect sampled from getTexture() (an atlas region, or the whole image); empty if not tracked
+                    virtual IntRect getTextureRect() const { return IntRect(); }
             };
 
         }
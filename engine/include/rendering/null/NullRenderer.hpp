@@ -0,0 +1,93 @@
+#ifndef ENG_ENGINE_RENDERING_NULL_NULLRENDERER_HPP
+#define ENG_ENGINE_RENDERING_NULL_NULLRENDERER_HPP
+
+#include <rendering/IRenderer.hpp>
+#include <rendering/null/NullSprite.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace null
+            {
+
+                // One sprite, text or rectangle as it would have reached the screen
+                struct DrawCommand {
+                    enum class Kind {
+                        Sprite,
+                        Text,
+                        Rect
+                    };
+
+                    Kind kind = Kind::Sprite;
+                    // Sprites: texture, layer (0 for immediate draw()), texture rect and transform
+                    const ITexture *texture = nullptr;
+                    int layer = 0;
+                    IntRect textureRect;
+                    Transform transform;
+                    // Rects: area and fill color
+                    FloatRect rect;
+                    uint32_t color = 0;
+                    // Draw call the command went out with (sprites of one batch share it)
+                    std::size_t drawCall = 0;
+                };
+
+                /**
+                 * @brief Renderer that records draw commands instead of rasterizing
+                 *
+                 * Needs no window or GPU, so the render path runs headless at
+                 * full speed (benchmarks, CI). Submitted sprites are grouped
+                 * and flushed exactly like SFMLRenderer: one draw call per
+                 * (layer, texture) batch, lowest layer first, and immediate
+                 * draws flush the queue before they are recorded. Draw calls
+                 * are counted in the Profiler too, so the two backends report
+                 * the same numbers.
+                 *
+                 * clear() starts a new frame (commands and counts reset);
+                 * display() ends it.
+                 */
+                class NullRenderer : public IRenderer {
+                    public:
+                        NullRenderer() = default;
+                        ~NullRenderer() override = default;
+
+                        // IRenderer implementation
+                        void clear() override;
+                        void draw(ISprite &sprite, const Transform &transform) override;
+                        void drawText(IText &text) override;
+                        void drawRect(const FloatRect &rect, uint32_t fillColor, uint32_t outlineColor = 0, float outlineThickness = 0.0f) override;
+                        void display() override;
+                        void setCamera(const Camera &camera) override;
+                        void submit(ISprite &sprite, const Transform &transform, int layer, const IntRect &textureRect = IntRect()) override;
+                        void flush() override;
+
+                        // Commands recorded since the last clear(), in drawing order
+                        const std::vector<DrawCommand> &getCommands() const { return commands_; }
+                        std::size_t getDrawCallCount() const { return drawCalls_; }
+                        std::size_t getSpriteCount() const;
+                        std::size_t getFrameCount() const { return frames_; }
+                        const Camera &getCamera() const { return camera_; }
+
+                    private:
+                        void recordDrawCall();
+
+                        std::vector<DrawCommand> commands_;
+                        // Submitted sprites waiting for flush(), in submission order
+                        std::vector<DrawCommand> pending_;
+                        std::vector<std::size_t> order_;
+                        std::size_t drawCalls_ = 0;
+                        std::size_t frames_ = 0;
+                        Camera camera_;
+                };
+
+            }
+        }
+    }
+}
+
+#endif // ENG_ENGINE_RENDERING_NULL_NULLRENDERER_HPP
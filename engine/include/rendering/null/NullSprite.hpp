@@ -0,0 +1,43 @@
+#ifndef ENG_ENGINE_RENDERING_NULL_NULLSPRITE_HPP
+#define ENG_ENGINE_RENDERING_NULL_NULLSPRITE_HPP
+
+#include <rendering/ISprite.hpp>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace null
+            {
+
+                class NullSprite : public ISprite {
+                    public:
+                        NullSprite() = default;
+                        ~NullSprite() override = default;
+
+                        // ISprite implementation
+                        void setTexture(ITexture *texture) override { texture_ = texture; }
+                        void setPosition(Vector2f position) override { position_ = position; }
+                        void setTextureRect(IntRect rect) override { textureRect_ = rect; }
+                        const ITexture *getTexture() const override { return texture_; }
+                        IntRect getTextureRect() const override { return textureRect_; }
+
+                        // Same contract as SFMLSprite::setAtlasRegion, minus the offsetting
+                        void setAtlasRegion(IntRect region) { textureRect_ = region; }
+
+                        Vector2f getPosition() const { return position_; }
+
+                    private:
+                        ITexture *texture_ = nullptr;
+                        Vector2f position_;
+                        IntRect textureRect_;
+                };
+
+            }
+        }
+    }
+}
+
+#endif // ENG_ENGINE_RENDERING_NULL_NULLSPRITE_HPP
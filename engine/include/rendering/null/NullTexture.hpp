@@ -0,0 +1,45 @@
+#ifndef ENG_ENGINE_RENDERING_NULL_NULLTEXTURE_HPP
+#define ENG_ENGINE_RENDERING_NULL_NULLTEXTURE_HPP
+
+#include <rendering/ITexture.hpp>
+#include <string>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace null
+            {
+
+                /**
+                 * @brief Texture that is never uploaded anywhere
+                 *
+                 * loadFromFile only checks the file exists and reads the
+                 * size from a PNG header, so sprite sizes (and culling) match
+                 * the SFML backend without decoding any pixels.
+                 */
+                class NullTexture : public ITexture {
+                    public:
+                        NullTexture() = default;
+                        explicit NullTexture(Vector2u size) : size_(size) {}
+                        ~NullTexture() override = default;
+
+                        Vector2u getSize() const override { return size_; }
+                        bool loadFromFile(const std::string &path) override;
+
+                        void setSize(Vector2u size) { size_ = size; }
+                        const std::string &getPath() const { return path_; }
+
+                    private:
+                        Vector2u size_;
+                        std::string path_;
+                };
+
+            }
+        }
+    }
+}
+
+#endif // ENG_ENGINE_RENDERING_NULL_NULLTEXTURE_HPP
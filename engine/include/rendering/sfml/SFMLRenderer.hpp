@@ -6,7 +6,10 @@
 #include <rendering/sfml/SFMLText.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace eng
 {
@@ -29,11 +32,27 @@ namespace eng
                         void drawRect(const FloatRect &rect, uint32_t fillColor, uint32_t outlineColor = 0, float outlineThickness = 0.0f) override;
                         void display() override;
                         void setCamera(const Camera &camera) override;
+                        void submit(ISprite &sprite, const Transform &transform, int layer, const IntRect &textureRect = IntRect()) override;
+                        void flush() override;
                         // Helper: get window
                         const sf::RenderWindow &getWindow() const { return *window_; }
 
                     private:
+                        // Sprites of one layer sharing a texture, as triangles
+                        struct Batch {
+                            int layer = 0;
+                            const sf::Texture *texture = nullptr;
+                            sf::VertexArray vertices{sf::Triangles};
+                        };
+
                         sf::RenderWindow *window_;
+                        // Pooled across frames: only the first activeBatches_ are in use
+                        std::vector<Batch> batches_;
+                        std::size_t activeBatches_ = 0;
+                        std::vector<std::size_t> drawOrder_;
+
+                        // Draws on the window and counts the call in the profiler
+                        void drawNative(const sf::Drawable &drawable, const sf::RenderStates &states = sf::RenderStates::Default);
 
                         // Helper to convert RGBA uint32 to sf::Color
                         static sf::Color toSFMLColor(uint32_t rgba);
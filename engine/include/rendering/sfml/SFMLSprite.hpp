@@ -23,6 +23,18 @@ namespace eng
                         void setTexture(ITexture *texture) override;
                         void setPosition(Vector2f position) override;
                         void setTextureRect(IntRect rect) override;
+                        const ITexture *getTexture() const override { return currentTexture_; }
+                        IntRect getTextureRect() const override;
+                        /**
+                         * @brief Maps the sprite onto a sub-image of an atlas page
+                         *
+                         * Call after setTexture(page). Texture rects set afterwards
+                         * stay relative to the original image and are offset into
+                         * the region; setTexture() drops the mapping.
+                         */
+                        void setAtlasRegion(IntRect region);
+                        // Rect in the native texture (atlas offset applied) for a rect in image coordinates
+                        sf::IntRect toNativeRect(IntRect rect) const;
                         // SFML-specific: get native sprite
                         const sf::Sprite &getNativeSprite() const { return sprite_; }
                         sf::Sprite &getNativeSprite() { return sprite_; }
@@ -30,6 +42,7 @@ namespace eng
                     private:
                         sf::Sprite sprite_;
                         SFMLTexture *currentTexture_;
+                        Vector2i atlasOffset_;
 
                 };
 
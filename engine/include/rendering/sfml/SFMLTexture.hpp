@@ -21,6 +21,9 @@ namespace eng
                         Vector2u getSize() const override;
                         bool loadFromFile(const std::string &path) override;
                         bool loadFromImage(const sf::Image &image, const sf::IntRect &area = sf::IntRect());
+                        // Blank (transparent) texture, filled later with update()
+                        bool create(unsigned int width, unsigned int height);
+                        void update(const sf::Image &image, unsigned int x, unsigned int y);
                         const sf::Texture &getNativeTexture() const { return texture_; }
                     private:
                         sf::Texture texture_;
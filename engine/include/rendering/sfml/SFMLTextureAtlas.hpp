@@ -0,0 +1,64 @@
+#ifndef ENG_ENGINE_RENDERING_SFML_SFMLTEXTUREATLAS_HPP
+#define ENG_ENGINE_RENDERING_SFML_SFMLTEXTUREATLAS_HPP
+
+#include <rendering/AtlasPacker.hpp>
+#include <rendering/sfml/SFMLTexture.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace sfml
+            {
+
+                /**
+                 * @brief Packs sprite sheets into shared atlas pages as they are loaded
+                 *
+                 * Each image file is read once; later requests for the same path
+                 * return the same region. Images go into the first page with room
+                 * (a new page is opened when none has), so sprites from different
+                 * sheets end up on one texture and batch together in the renderer.
+                 * Images wider or taller than maxImageSize (backgrounds) are
+                 * refused and should keep their own texture.
+                 */
+                class SFMLTextureAtlas {
+                    public:
+                        struct Region {
+                            SFMLTexture *texture = nullptr;
+                            IntRect rect;
+                        };
+
+                        explicit SFMLTextureAtlas(unsigned int pageSize = 2048, unsigned int maxImageSize = 1024, unsigned int padding = 1);
+
+                        // Loads `path` into a page if needed; false if it cannot be read or is too large
+                        bool acquire(const std::string &path, Region &region);
+
+                        std::size_t getPageCount() const { return pages_.size(); }
+                        std::size_t getImageCount() const { return regions_.size(); }
+
+                    private:
+                        struct Page {
+                            std::unique_ptr<SFMLTexture> texture;
+                            AtlasPacker packer;
+                        };
+
+                        unsigned int pageSize_;
+                        unsigned int maxImageSize_;
+                        unsigned int padding_;
+                        std::vector<Page> pages_;
+                        std::unordered_map<std::string, Region> regions_;
+                };
+
+            }
+        }
+    }
+}
+
+#endif // ENG_ENGINE_RENDERING_SFML_SFMLTEXTUREATLAS_HPP
@@ -3,11 +3,16 @@
 
 #include <core/Export.hpp>
 #include <ecs/System.hpp>
+#include <cstdint>
+#include <vector>
 
 namespace ECS {
     class Coordinator;
 }
 
+struct Animation;
+struct Sprite;
+
 class RTYPE_API AnimationSystem : public ECS::System {
     public:
         AnimationSystem();
@@ -20,7 +25,33 @@ class RTYPE_API AnimationSystem : public ECS::System {
         void SetCoordinator(ECS::Coordinator* coordinator) { coordinator_ = coordinator; }
 
     private:
+        // Everything a frame step reads and writes
+        struct Phase {
+            float currentTime;
+            float frameTime;
+            int currentFrame;
+            int frameCount;
+            bool loop;
+            bool finished;
+        };
+
+        /**
+         * Packed per-frame copy of one animation, next to the components it
+         * goes back to. Stepping runs over this array only, with no
+         * component lookup or virtual call.
+         */
+        struct State {
+            Phase phase;
+            bool frameChanged;
+            bool hide;
+            Animation* animation;
+            Sprite* sprite;
+        };
+
+        static void Step(State& state, float dt);
+
         ECS::Coordinator* coordinator_;
+        std::vector<State> states_;
 };
 
 #endif // ENG_ENGINE_SYSTEMS_ANIMATIONSYSTEM_HPP
@@ -11,6 +11,7 @@
 #include <core/Export.hpp>
 #include "ecs/System.hpp"
 #include "ecs/Coordinator.hpp"
+#include "ecs/CommandBuffer.hpp"
 #include "ecs/Types.hpp"
 #include "components/AudioSource.hpp"
 #include "engine/Audio.hpp"
@@ -41,7 +42,11 @@ public:
     void Update(float deltaTime) override;
     void Shutdown() override;
 
-    void SetCoordinator(::ECS::Coordinator* coordinator) { m_coordinator = coordinator; }
+    void SetCoordinator(::ECS::Coordinator* coordinator)
+    {
+        m_coordinator = coordinator;
+        m_commands.SetCoordinator(coordinator);
+    }
 
     // Volume control
     void SetSFXVolume(float volume);
@@ -58,6 +63,9 @@ public:
 
 private:
     ::ECS::Coordinator* m_coordinator = nullptr;
+
+    // Auto-destroys recorded during Update, applied once it finishes
+    ::ECS::CommandBuffer m_commands;
     
     // Base path for SFX files
     std::string m_baseSFXPath;
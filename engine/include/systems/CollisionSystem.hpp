@@ -5,7 +5,11 @@
 #include <ecs/Coordinator.hpp>
 #include <components/Position.hpp>
 #include <components/Collider.hpp>
+#include <physics/SpatialHash.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <utility>
 #include <vector>
 
 /**
@@ -15,6 +19,16 @@
  * It does NOT know about game-specific entity types (player, enemy, projectile).
  * All game-specific logic (damage, destruction, effects) should be handled in the callback.
  * 
+ * Broad phase: boxes are inserted into a uniform spatial hash each frame, so
+ * only entities sharing a grid cell are tested (instead of every pair). Pairs
+ * are reported in the same order and with the same (a, b) argument order as a
+ * full pairwise scan of the system's entities. The callback may destroy
+ * entities or disable colliders; pairs involving them are then skipped.
+ * 
+ * Collider::layer / Collider::mask filter pairs in the broad phase: two
+ * colliders are only tested (and reported) when each mask contains the
+ * other's layer, so same-faction pairs never reach the callback.
+ * 
  * Usage:
  *   auto collisionSystem = coordinator.RegisterSystem<CollisionSystem>(&coordinator);
  *   collisionSystem->SetCollisionCallback([](Entity a, Entity b) {
@@ -35,14 +49,38 @@ public:
     void Update(float /* deltaTime */) override {
         if (!m_Coordinator) return;
         
-        std::vector<ECS::Entity> entities(mEntities.begin(), mEntities.end());
+        // Gather boxes once per entity
+        m_Bodies.clear();
+        m_Grid.clear();
+        for (ECS::Entity entity : mEntities.Dense()) {
+            if (!m_Coordinator->HasComponent<Position>(entity) || !m_Coordinator->HasComponent<Collider>(entity))
+                continue;
+            const auto& pos = m_Coordinator->GetComponent<Position>(entity);
+            const auto& col = m_Coordinator->GetComponent<Collider>(entity);
+            if (!col.enabled)
+                continue;
+            
+            const float left = pos.x + col.offsetX;
+            const float top = pos.y + col.offsetY;
+            m_Grid.insert({left, top, left + col.width, top + col.height}, col.layer, col.mask);
+            m_Bodies.push_back(entity);
+        }
         
-        // Check all pairs of entities for collision
-        for (size_t i = 0; i < entities.size(); ++i) {
-            for (size_t j = i + 1; j < entities.size(); ++j) {
-                if (CheckCollisionAABB(entities[i], entities[j])) {
-                    OnCollision(entities[i], entities[j]);
-                }
+        m_Pairs.clear();
+        m_Grid.build();
+        m_LastTestCount = m_Grid.forEachPair([this](std::uint32_t a, std::uint32_t b) {
+            const ECS::Entity first = m_Bodies[a];
+            const ECS::Entity second = m_Bodies[b];
+            m_Pairs.emplace_back(std::min(first, second), std::max(first, second));
+        });
+        // Ascending entity pairs, as a pairwise scan in entity order would report them,
+        // whatever order the membership list is in
+        std::sort(m_Pairs.begin(), m_Pairs.end());
+        m_LastPairCount = m_Pairs.size();
+        
+        for (const auto& [a, b] : m_Pairs) {
+            if (IsStillColliding(a) && IsStillColliding(b)) {
+                OnCollision(a, b);
             }
         }
     }
@@ -59,45 +97,38 @@ public:
         m_CollisionCallback = std::move(callback);
     }
     
+    /**
+     * @brief Side of a broad-phase grid cell, in world units
+     * Roughly the size of the largest common collider (ships, enemies)
+     */
+    void SetCellSize(float cellSize) {
+        m_Grid.setCellSize(cellSize);
+    }
+    
+    // Overlapping pairs found by the last Update (before the callback ran)
+    size_t GetLastPairCount() const { return m_LastPairCount; }
+    // Box tests performed by the last Update's broad phase
+    size_t GetLastTestCount() const { return m_LastTestCount; }
+    
     const char* GetName() const { return "CollisionSystem"; }
-    uint32_t GetVersion() const { return 1; }
+    uint32_t GetVersion() const { return 2; }
     
 private:
     ECS::Coordinator* m_Coordinator = nullptr;
     CollisionCallback m_CollisionCallback;
     
-    /**
-     * @brief Check AABB collision between two entities
-     * Uses Position and Collider components
-     */
-    bool CheckCollisionAABB(ECS::Entity a, ECS::Entity b) {
-        if (!m_Coordinator->HasComponent<Position>(a) || !m_Coordinator->HasComponent<Position>(b))
-            return false;
-        if (!m_Coordinator->HasComponent<Collider>(a) || !m_Coordinator->HasComponent<Collider>(b))
-            return false;
-        
-        auto& posA = m_Coordinator->GetComponent<Position>(a);
-        auto& posB = m_Coordinator->GetComponent<Position>(b);
-        auto& colA = m_Coordinator->GetComponent<Collider>(a);
-        auto& colB = m_Coordinator->GetComponent<Collider>(b);
-        
-        // Skip if either collider is disabled
-        if (!colA.enabled || !colB.enabled)
+    // Per-frame buffers, kept to avoid reallocating every Update
+    eng::engine::physics::SpatialHash m_Grid;
+    std::vector<ECS::Entity> m_Bodies;
+    std::vector<std::pair<ECS::Entity, ECS::Entity>> m_Pairs;
+    size_t m_LastPairCount = 0;
+    size_t m_LastTestCount = 0;
+    
+    // An earlier callback of this frame may have destroyed the entity or disabled its collider
+    bool IsStillColliding(ECS::Entity entity) const {
+        if (!m_Coordinator->IsAlive(entity) || !m_Coordinator->HasComponent<Collider>(entity))
             return false;
-        
-        // AABB (Axis-Aligned Bounding Box) collision
-        float aLeft = posA.x + colA.offsetX;
-        float aRight = aLeft + colA.width;
-        float aTop = posA.y + colA.offsetY;
-        float aBottom = aTop + colA.height;
-        
-        float bLeft = posB.x + colB.offsetX;
-        float bRight = bLeft + colB.width;
-        float bTop = posB.y + colB.offsetY;
-        float bBottom = bTop + colB.height;
-        
-        return (aLeft < bRight && aRight > bLeft &&
-                aTop < bBottom && aBottom > bTop);
+        return m_Coordinator->GetComponent<Collider>(entity).enabled;
     }
     
     void OnCollision(ECS::Entity a, ECS::Entity b) {
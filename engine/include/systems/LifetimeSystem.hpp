@@ -3,6 +3,8 @@
 #include <core/Export.hpp>
 #include <ecs/System.hpp>
 #include <ecs/Coordinator.hpp>
+#include <ecs/CommandBuffer.hpp>
+#include <ecs/ParallelForEach.hpp>
 #include <ecs/Components.hpp>
 
 class RTYPE_API LifetimeSystem : public ECS::System {
@@ -13,12 +15,23 @@ class RTYPE_API LifetimeSystem : public ECS::System {
         void Init() override;
         void Update(float dt) override;
         void Shutdown() override;
+        void ApplyDeferred() override;
 
         const char* GetName() const { return "LifetimeSystem"; }
         uint32_t GetSystemVersion() const { return 1; }
 
+        // Splits the update across the pool once enough entities age (nullptr = serial)
+        void SetThreadPool(ECS::ThreadPool* pool, ECS::ParallelOptions options = {})
+        {
+            m_ThreadPool = pool;
+            m_ParallelOptions = options;
+        }
+
     private:
         ECS::Coordinator* m_Coordinator;
+        ECS::ThreadPool* m_ThreadPool = nullptr;
+        ECS::ParallelOptions m_ParallelOptions;
+        ECS::CommandBuffer m_Commands;  // Expired entities, destroyed in ApplyDeferred
 };
 
 extern "C" {
@@ -3,6 +3,7 @@
 #include <core/Export.hpp>
 #include <ecs/System.hpp>
 #include <ecs/Coordinator.hpp>
+#include <ecs/ParallelForEach.hpp>
 #include <ecs/Components.hpp>
 
 class RTYPE_API MovementSystem : public ECS::System {
@@ -17,8 +18,17 @@ class RTYPE_API MovementSystem : public ECS::System {
         const char* GetName() const { return "MovementSystem"; }
         uint32_t GetVersion() const { return 1; }
 
+        // Splits the update across the pool once enough entities move (nullptr = serial)
+        void SetThreadPool(ECS::ThreadPool* pool, ECS::ParallelOptions options = {})
+        {
+            m_ThreadPool = pool;
+            m_ParallelOptions = options;
+        }
+
     private:
         ECS::Coordinator* m_Coordinator;
+        ECS::ThreadPool* m_ThreadPool = nullptr;
+        ECS::ParallelOptions m_ParallelOptions;
 };
 
 // C API for dynamic loading
@@ -2,7 +2,10 @@
 #define ENG_ENGINE_SYSTEMS_RENDERSYSTEM_HPP
 
 #include <ecs/System.hpp>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace eng
 {
@@ -10,7 +13,9 @@ namespace eng
     {
         namespace rendering
         {
+            class Camera;
             class IRenderer;
+            class ITexture;
         }
     }
 }
@@ -20,21 +25,75 @@ namespace ECS
     class Coordinator;
 }
 
+struct Position;
+struct Sprite;
+
 class RenderSystem : public ECS::System {
     public:
         RenderSystem();
-        ~RenderSystem() override = default;
+        ~RenderSystem() override;
 
         void Init() override;
         void Update(float dt) override;
         void Shutdown() override;
 
         void SetRenderer(eng::engine::rendering::IRenderer *renderer) { renderer_ = renderer; }
-        void SetCoordinator(ECS::Coordinator *coordinator) { coordinator_ = coordinator; }
+        // Sprites outside the camera's visible area are not submitted; null disables culling
+        void SetCamera(const eng::engine::rendering::Camera *camera) { camera_ = camera; }
+        // Also registers the tag census reported by the Profiler
+        void SetCoordinator(ECS::Coordinator *coordinator);
+
+    protected:
+        void OnEntityAdded(ECS::Entity entity) override;
+        void OnEntityRemoved(ECS::Entity entity) override;
 
     private:
+        /**
+         * Draw order is kept between frames in buckets, one per
+         * (layer, texture) pair in use, walked in (layer, texture) order.
+         * Joining, leaving or changing layer/texture moves a single entity
+         * in or out of a bucket (swap-and-pop); nothing is ever re-sorted,
+         * and a frame otherwise only walks the buckets.
+         */
+        struct QueueItem {
+            ECS::Entity entity = 0;
+            // Valid during one Update only
+            Position *position = nullptr;
+            Sprite *sprite = nullptr;
+        };
+
+        struct Bucket {
+            int layer = 0;
+            const eng::engine::rendering::ITexture *texture = nullptr;
+            uint32_t textureId = 0; // Textures numbered in first-seen order
+            std::vector<QueueItem> items;
+        };
+
+        // Where an entity sits: a bucket and its index there, or pending_
+        struct Slot {
+            uint32_t bucket = NO_BUCKET;
+            uint32_t index = 0;
+        };
+        static constexpr uint32_t NO_BUCKET = 0xFFFFFFFFu;
+        static constexpr uint32_t PENDING = 0xFFFFFFFEu;
+
+        Slot &SlotOf(ECS::Entity entity);
+        uint32_t BucketFor(int layer, const eng::engine::rendering::ITexture *texture);
+        static const eng::engine::rendering::ITexture *TextureOf(const Sprite &sprite);
+        void Place(const QueueItem &item);
+        void Unplace(ECS::Entity entity);
+
         eng::engine::rendering::IRenderer *renderer_;
         ECS::Coordinator *coordinator_;
+        const eng::engine::rendering::Camera *camera_ = nullptr;
+
+        std::vector<Bucket> buckets_;
+        std::vector<uint32_t> bucketOrder_; // Bucket indices by (layer, textureId)
+        std::unordered_map<uint64_t, uint32_t> bucketByKey_;
+        std::unordered_map<const eng::engine::rendering::ITexture *, uint32_t> textureIds_;
+        std::vector<Slot> slots_;            // Indexed by entity
+        std::vector<ECS::Entity> pending_;   // Joined, not placed yet (no coordinator or components)
+        std::vector<QueueItem> moved_;       // Scratch: items whose layer or texture changed
 };
 
 #endif // ENG_ENGINE_SYSTEMS_RENDERSYSTEM_HPP
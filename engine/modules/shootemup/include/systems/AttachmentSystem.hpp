@@ -3,6 +3,7 @@
 
 #include <ecs/System.hpp>
 #include <ecs/Coordinator.hpp>
+#include <ecs/CommandBuffer.hpp>
 #include <components/ForcePod.hpp>
 #include <components/Position.hpp>
 #include <components/Velocity.hpp>
@@ -25,9 +26,13 @@ namespace Systems {
 class ForcePodSystem : public ECS::System {
 public:
     ForcePodSystem() = default;
-    explicit ForcePodSystem(ECS::Coordinator* coord) : coordinator_(coord) {}
+    explicit ForcePodSystem(ECS::Coordinator* coord) : coordinator_(coord), commands_(coord) {}
     
-    void SetCoordinator(ECS::Coordinator* coord) { coordinator_ = coord; }
+    void SetCoordinator(ECS::Coordinator* coord)
+    {
+        coordinator_ = coord;
+        commands_.SetCoordinator(coord);
+    }
     
     void Init() override {}
     void Shutdown() override {}
@@ -36,8 +41,8 @@ public:
     // Force pod management
     void CreateForcePod(ECS::Entity owner);
     void DestroyForcePod();
-    bool HasForcePod() const { return forcePodEntity_ != 0; }
-    ECS::Entity GetForcePod() const { return forcePodEntity_; }
+    bool HasForcePod() const { return coordinator_ && coordinator_->IsAlive(forcePodEntity_); }
+    ECS::EntityHandle GetForcePod() const { return forcePodEntity_; }
     
     // Force pod actions
     void AttachToFront();
@@ -67,7 +72,8 @@ public:
     
 private:
     ECS::Coordinator* coordinator_ = nullptr;
-    ECS::Entity forcePodEntity_ = 0;
+    ECS::CommandBuffer commands_;  // Batches pod creation into one membership update
+    ECS::EntityHandle forcePodEntity_;  // Null until CreateForcePod; stale once the pod is destroyed
     ECS::Entity ownerEntity_ = 0;
     
     ProjectileCallback projectileCb_;
@@ -87,9 +93,13 @@ private:
 class OptionSystem : public ECS::System {
 public:
     OptionSystem() = default;
-    explicit OptionSystem(ECS::Coordinator* coord) : coordinator_(coord) {}
+    explicit OptionSystem(ECS::Coordinator* coord) : coordinator_(coord), commands_(coord) {}
     
-    void SetCoordinator(ECS::Coordinator* coord) { coordinator_ = coord; }
+    void SetCoordinator(ECS::Coordinator* coord)
+    {
+        coordinator_ = coord;
+        commands_.SetCoordinator(coord);
+    }
     
     void Init() override {}
     void Shutdown() override {}
@@ -120,6 +130,7 @@ public:
     
 private:
     ECS::Coordinator* coordinator_ = nullptr;
+    ECS::CommandBuffer commands_;  // Batches option creation/removal
     ECS::Entity ownerEntity_ = 0;
     std::vector<ECS::Entity> optionEntities_;
     
@@ -57,12 +57,12 @@ public:
     void SetMinionSpawnCallback(MinionSpawnCallback cb) { minionSpawnCb_ = cb; }
     
     // Player reference for targeting
-    void SetPlayerEntity(ECS::Entity player) { playerEntity_ = player; }
+    void SetPlayerEntity(ECS::EntityHandle player) { playerEntity_ = player; }
     
 private:
     ECS::Coordinator* coordinator_ = nullptr;
     ECS::Entity activeBoss_ = 0;
-    ECS::Entity playerEntity_ = 0;
+    ECS::EntityHandle playerEntity_;  // Null or dead: no target
     
     // Callbacks
     AttackCallback attackCallback_;
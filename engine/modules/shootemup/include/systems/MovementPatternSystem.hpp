@@ -19,12 +19,12 @@ class MovementPatternSystem : public ECS::System {
 
         void SetCoordinator(ECS::Coordinator* coordinator) { coordinator_ = coordinator; }
         void SetWindowHeight(float height) { windowHeight_ = height; }
-        void SetPlayerEntity(ECS::Entity player) { playerEntity_ = player; }
+        void SetPlayerEntity(ECS::EntityHandle player) { playerEntity_ = player; }
 
     private:
         ECS::Coordinator* coordinator_;
         float windowHeight_ = 1080.0f;
-        ECS::Entity playerEntity_ = 0;
+        ECS::EntityHandle playerEntity_;  // Null or dead: no target
 };
 
 #endif // SHOOTEMUP_SYSTEMS_MOVEMENTPATTERNSYSTEM_HPP
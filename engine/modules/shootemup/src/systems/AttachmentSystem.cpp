@@ -11,14 +11,13 @@ namespace Systems {
 // ============================================================================
 
 void ForcePodSystem::Update(float dt) {
-    if (forcePodEntity_ == 0) return;
-    
-    if (!coordinator_->HasComponent<Components::ForcePod>(forcePodEntity_)) {
-        forcePodEntity_ = 0;
+    if (!HasForcePod()) {
+        // Never created, or destroyed behind our back: drop the stale handle
+        forcePodEntity_ = {};
         return;
     }
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     switch (force.state) {
         case Components::ForcePod::State::AttachedFront:
@@ -38,13 +37,14 @@ void ForcePodSystem::Update(float dt) {
 }
 
 void ForcePodSystem::CreateForcePod(ECS::Entity owner) {
-    if (forcePodEntity_ != 0) {
+    if (HasForcePod()) {
         LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force pod already exists!");
         return;
     }
     
     ownerEntity_ = owner;
-    forcePodEntity_ = coordinator_->CreateEntity();
+    const ECS::Entity pod = commands_.CreateEntity();
+    forcePodEntity_ = coordinator_->GetHandle(pod);
     
     // Get owner position
     float startX = 0, startY = 0;
@@ -54,59 +54,60 @@ void ForcePodSystem::CreateForcePod(ECS::Entity owner) {
         startY = pos.y;
     }
     
-    // Add components
-    coordinator_->AddComponent(forcePodEntity_, Position{startX, startY});
-    coordinator_->AddComponent(forcePodEntity_, Velocity{0, 0});
+    // Add components (one signature change for the whole pod)
+    commands_.AddComponent(pod, Position{startX, startY});
+    commands_.AddComponent(pod, Velocity{0, 0});
     
     Components::ForcePod force;
     force.owner = owner;
     force.state = Components::ForcePod::State::Detached;
     force.level = 1;
-    coordinator_->AddComponent(forcePodEntity_, force);
+    commands_.AddComponent(pod, force);
+    commands_.Flush();
     
     LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force pod created!");
 }
 
 void ForcePodSystem::DestroyForcePod() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
     coordinator_->DestroyEntity(forcePodEntity_);
-    forcePodEntity_ = 0;
+    forcePodEntity_ = {};
     
     LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force pod destroyed");
 }
 
 void ForcePodSystem::AttachToFront() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     force.state = Components::ForcePod::State::AttachedFront;
     
     LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force attached to FRONT");
 }
 
 void ForcePodSystem::AttachToBack() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     force.state = Components::ForcePod::State::AttachedBack;
     
     LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force attached to BACK");
 }
 
 void ForcePodSystem::Detach() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     force.state = Components::ForcePod::State::Detached;
     
     LOG_INFO("ATTACHMENTSYSTEM", "[ForcePodSystem] Force DETACHED");
 }
 
 void ForcePodSystem::Launch() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     if (force.state == Components::ForcePod::State::AttachedFront ||
         force.state == Components::ForcePod::State::AttachedBack) {
@@ -115,7 +116,7 @@ void ForcePodSystem::Launch() {
         force.currentLaunchDistance = 0;
         
         // Set velocity based on attachment side
-        auto& vel = coordinator_->GetComponent<Velocity>(forcePodEntity_);
+        auto& vel = coordinator_->GetComponent<Velocity>(forcePodEntity_.index);
         if (force.state == Components::ForcePod::State::AttachedFront) {
             vel.dx = force.launchSpeed;
         } else {
@@ -128,9 +129,9 @@ void ForcePodSystem::Launch() {
 }
 
 void ForcePodSystem::Recall() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     if (force.state == Components::ForcePod::State::Detached ||
         force.state == Components::ForcePod::State::Launching) {
@@ -142,9 +143,9 @@ void ForcePodSystem::Recall() {
 }
 
 void ForcePodSystem::ToggleAttachment() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     switch (force.state) {
         case Components::ForcePod::State::Detached:
@@ -162,9 +163,9 @@ void ForcePodSystem::ToggleAttachment() {
 }
 
 void ForcePodSystem::UpgradeForce() {
-    if (forcePodEntity_ == 0) return;
+    if (!HasForcePod()) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     if (force.level < 3) {
         force.level++;
@@ -173,19 +174,16 @@ void ForcePodSystem::UpgradeForce() {
 }
 
 int ForcePodSystem::GetForceLevel() const {
-    if (forcePodEntity_ == 0) return 0;
+    if (!HasForcePod()) return 0;
     
-    if (coordinator_->HasComponent<Components::ForcePod>(forcePodEntity_)) {
-        return coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_).level;
-    }
-    return 0;
+    return coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index).level;
 }
 
 void ForcePodSystem::Fire() {
-    if (forcePodEntity_ == 0 || !projectileCb_) return;
+    if (!HasForcePod() || !projectileCb_) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
-    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
+    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_.index);
     
     // Determine fire directions based on level and state
     std::vector<float> angles;
@@ -226,8 +224,8 @@ void ForcePodSystem::Fire() {
 void ForcePodSystem::UpdateAttached(float dt) {
     if (ownerEntity_ == 0) return;
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
-    auto& forcePos = coordinator_->GetComponent<Position>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
+    auto& forcePos = coordinator_->GetComponent<Position>(forcePodEntity_.index);
     auto& ownerPos = coordinator_->GetComponent<Position>(ownerEntity_);
     
     if (force.state == Components::ForcePod::State::AttachedFront) {
@@ -241,8 +239,8 @@ void ForcePodSystem::UpdateAttached(float dt) {
 
 void ForcePodSystem::UpdateDetached(float dt) {
     // Force floats in place, maybe slight hover
-    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_);
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_.index);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
     
     static float hoverTime = 0;
     hoverTime += dt;
@@ -251,9 +249,9 @@ void ForcePodSystem::UpdateDetached(float dt) {
 }
 
 void ForcePodSystem::UpdateLaunching(float dt) {
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
-    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_);
-    auto& vel = coordinator_->GetComponent<Velocity>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
+    auto& pos = coordinator_->GetComponent<Position>(forcePodEntity_.index);
+    auto& vel = coordinator_->GetComponent<Velocity>(forcePodEntity_.index);
     
     force.currentLaunchDistance += std::abs(vel.dx) * dt;
     
@@ -266,13 +264,13 @@ void ForcePodSystem::UpdateLaunching(float dt) {
 
 void ForcePodSystem::UpdateReturning(float dt) {
     if (ownerEntity_ == 0) {
-        auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
+        auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
         force.state = Components::ForcePod::State::Detached;
         return;
     }
     
-    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_);
-    auto& forcePos = coordinator_->GetComponent<Position>(forcePodEntity_);
+    auto& force = coordinator_->GetComponent<Components::ForcePod>(forcePodEntity_.index);
+    auto& forcePos = coordinator_->GetComponent<Position>(forcePodEntity_.index);
     auto& ownerPos = coordinator_->GetComponent<Position>(ownerEntity_);
     
     float dx = ownerPos.x - forcePos.x;
@@ -322,7 +320,7 @@ void OptionSystem::AddOption() {
         return;
     }
     
-    ECS::Entity option = coordinator_->CreateEntity();
+    ECS::Entity option = commands_.CreateEntity();
     
     // Get owner position for initial placement
     float startX = 0, startY = 0;
@@ -332,12 +330,13 @@ void OptionSystem::AddOption() {
         startY = pos.y;
     }
     
-    coordinator_->AddComponent(option, Position{startX, startY});
+    commands_.AddComponent(option, Position{startX, startY});
     
     Components::Option opt;
     opt.owner = ownerEntity_;
     opt.optionIndex = static_cast<int>(optionEntities_.size());
-    coordinator_->AddComponent(option, opt);
+    commands_.AddComponent(option, opt);
+    commands_.Flush();
     
     optionEntities_.push_back(option);
     
@@ -357,8 +356,9 @@ void OptionSystem::RemoveOption() {
 
 void OptionSystem::RemoveAllOptions() {
     for (auto option : optionEntities_) {
-        coordinator_->DestroyEntity(option);
+        commands_.DestroyEntity(option);
     }
+    commands_.Flush();
     optionEntities_.clear();
     
     LOG_INFO("ATTACHMENTSYSTEM", "[OptionSystem] All options removed");
@@ -161,8 +161,8 @@ void BossSystem::UpdateMovement(ECS::Entity boss, float dt) {
     }
     else if (bossComp.movementPattern == "aggressive") {
         // Moves towards player occasionally
-        if (playerEntity_ != 0 && coordinator_->HasComponent<Position>(playerEntity_)) {
-            auto& playerPos = coordinator_->GetComponent<Position>(playerEntity_);
+        if (coordinator_->IsAlive(playerEntity_) && coordinator_->HasComponent<Position>(playerEntity_.index)) {
+            auto& playerPos = coordinator_->GetComponent<Position>(playerEntity_.index);
             
             // Smoothly follow player Y
             float targetY = playerPos.y;
@@ -381,11 +381,11 @@ void BossSystem::ExecuteChargeAttack(ECS::Entity boss, float speed) {
 }
 
 float BossSystem::GetAngleToPlayer(float bossX, float bossY) {
-    if (playerEntity_ == 0) return 180.0f;  // Default: shoot left
+    if (!coordinator_->IsAlive(playerEntity_)) return 180.0f;  // Default: shoot left
     
-    if (!coordinator_->HasComponent<Position>(playerEntity_)) return 180.0f;
+    if (!coordinator_->HasComponent<Position>(playerEntity_.index)) return 180.0f;
     
-    auto& playerPos = coordinator_->GetComponent<Position>(playerEntity_);
+    auto& playerPos = coordinator_->GetComponent<Position>(playerEntity_.index);
     
     float dx = playerPos.x - bossX;
     float dy = playerPos.y - bossY;
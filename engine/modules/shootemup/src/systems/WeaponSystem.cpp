@@ -26,12 +26,7 @@ void WeaponSystem::Update(float dt)
 {
     if (!coordinator_) return;
 
-    for (auto entity : mEntities) {
-        if (!coordinator_->HasComponent<Weapon>(entity))
-            continue;
-
-        auto& weapon = coordinator_->GetComponent<Weapon>(entity);
-
+    coordinator_->View<Weapon>().Each([dt](ECS::Entity, Weapon& weapon) {
         weapon.lastFireTime += dt;
 
         // Update charge time if charging
@@ -46,7 +41,7 @@ void WeaponSystem::Update(float dt)
 
         // Note: Actual firing is triggered by InputSystem or AI
         // This system just manages cooldowns and charge state
-    }
+    });
 }
 
 void WeaponSystem::CreateProjectile(ECS::Entity owner, bool charged, int chargeLevel)
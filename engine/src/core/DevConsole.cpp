@@ -193,6 +193,7 @@ void DevConsole::registerBuiltinCommands()
             ss << "Frame Time: " << profiler.getFrameTimeMs() << " ms\n";
             ss << "Entities: " << profiler.getEntityCount() << "\n";
             ss << "Draw Calls: " << profiler.getDrawCalls() << "\n";
+            ss << "Sprites: " << profiler.getSpritesDrawn() << " drawn, " << profiler.getSpritesCulled() << " culled\n";
             ss << "Memory: " << profiler.getMemoryUsageMB() << " MB";
             return ss.str();
         });
@@ -239,6 +239,13 @@ void Profiler::resetDrawCalls()
     _currentFrame.drawCalls = 0;
 }
 
+void Profiler::setSpriteCounts(uint64_t drawn, uint64_t culled)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _currentFrame.spritesDrawn = drawn;
+    _currentFrame.spritesCulled = culled;
+}
+
 void Profiler::updateMemoryUsage()
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -342,6 +349,18 @@ uint64_t Profiler::getDrawCalls() const
     return _currentFrame.drawCalls;
 }
 
+uint64_t Profiler::getSpritesDrawn() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _currentFrame.spritesDrawn;
+}
+
+uint64_t Profiler::getSpritesCulled() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _currentFrame.spritesCulled;
+}
+
 size_t Profiler::getMemoryUsageMB() const
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -401,8 +420,46 @@ void Profiler::setHistorySize(size_t size)
     }
 }
 
+void Profiler::registerEntityCensus(const void* owner, CensusFunction census)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& entry : _censuses) {
+        if (entry.first == owner) {
+            entry.second = std::move(census);
+            return;
+        }
+    }
+    _censuses.emplace_back(owner, std::move(census));
+}
+
+void Profiler::unregisterEntityCensus(const void* owner)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _censuses.erase(std::remove_if(_censuses.begin(), _censuses.end(),
+        [owner](const auto& entry) { return entry.first == owner; }), _censuses.end());
+}
+
+std::map<std::string, uint64_t> Profiler::getEntityCensus() const
+{
+    // Run outside the lock: the census walks game state, not the profiler
+    std::vector<CensusFunction> censuses;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& entry : _censuses) {
+            censuses.push_back(entry.second);
+        }
+    }
+
+    std::map<std::string, uint64_t> counts;
+    for (const auto& census : censuses) {
+        census(counts);
+    }
+    return counts;
+}
+
 std::string Profiler::generateReport() const
 {
+    const auto census = getEntityCensus();
     std::lock_guard<std::mutex> lock(_mutex);
     
     std::ostringstream report;
@@ -415,6 +472,7 @@ std::string Profiler::generateReport() const
     report << "Frame Time: " << _currentFrameTimeMs << " ms (min: " << _minFrameTimeMs << ", max: " << _maxFrameTimeMs << ")\n";
     report << "Entities: " << _currentFrame.entityCount << "\n";
     report << "Draw Calls: " << _currentFrame.drawCalls << "\n";
+    report << "Sprites: " << _currentFrame.spritesDrawn << " drawn, " << _currentFrame.spritesCulled << " culled\n";
     report << "Memory: " << (_lastMemoryUsage / (1024 * 1024)) << " MB\n";
     
     if (!_sections.empty()) {
@@ -433,6 +491,13 @@ std::string Profiler::generateReport() const
         }
     }
     
+    if (!census.empty()) {
+        report << "\n--- Entity Census ---\n";
+        for (const auto& [label, count] : census) {
+            report << "  " << label << ": " << count << "\n";
+        }
+    }
+
     if (_networkStats.packetsSent > 0 || _networkStats.packetsReceived > 0) {
         report << "\n--- Network Stats ---\n";
         report << "  Packets Sent: " << _networkStats.packetsSent << " (" << (_networkStats.bytesSent / 1024) << " KB)\n";
@@ -143,6 +143,7 @@ void ProfilerOverlay::updateText()
     statsStream << "Frame: " << profiler.getFrameTimeMs() << " ms\n";
     statsStream << "Entities: " << profiler.getEntityCount() << "\n";
     statsStream << "Draw Calls: " << profiler.getDrawCalls() << "\n";
+    statsStream << "Sprites: " << profiler.getSpritesDrawn() << " drawn / " << profiler.getSpritesCulled() << " culled\n";
     statsStream << "Memory: " << profiler.getMemoryUsageMB() << " MB";
     _statsText.setString(statsStream.str());
     
@@ -0,0 +1,182 @@
+#include <ecs/Archetype.hpp>
+#include <algorithm>
+
+namespace ECS {
+
+namespace {
+
+std::size_t AlignUp(std::size_t value, std::size_t align)
+{
+    return (value + align - 1) & ~(align - 1);
+}
+
+} // namespace
+
+Archetype::Archetype(Signature signature, const std::array<ComponentInfo, MAX_COMPONENTS>& infos)
+    : mSignature(signature)
+    , mInfos(infos)
+{
+    mColumnOffsets.fill(NO_COLUMN);
+    for (ComponentType type = 0; type < MAX_COMPONENTS; ++type) {
+        if (mSignature.test(type)) {
+            mTypes.push_back(type);
+            mChunkAlign = std::max(mChunkAlign, mInfos[type].align);
+        }
+    }
+
+    // Bytes needed for `rows` rows: Entity column then one aligned column per type
+    auto layoutBytes = [this](std::size_t rows) {
+        std::size_t offset = rows * sizeof(Entity);
+        for (ComponentType type : mTypes) {
+            offset = AlignUp(offset, mInfos[type].align) + rows * mInfos[type].size;
+        }
+        return offset;
+    };
+
+    // Largest power-of-two row count that fits the chunk budget (at least one row)
+    while (layoutBytes(std::size_t(2) << mChunkShift) <= ARCHETYPE_CHUNK_BYTES) {
+        ++mChunkShift;
+    }
+    const std::size_t rows = std::size_t(1) << mChunkShift;
+    mChunkBytes = std::max(layoutBytes(rows), ARCHETYPE_CHUNK_BYTES);
+
+    std::size_t offset = rows * sizeof(Entity);
+    for (ComponentType type : mTypes) {
+        offset = AlignUp(offset, mInfos[type].align);
+        mColumnOffsets[type] = offset;
+        offset += rows * mInfos[type].size;
+    }
+}
+
+Archetype::~Archetype()
+{
+    while (mSize > 0) {
+        RemoveRow(mSize - 1);
+    }
+    for (std::byte* chunk : mChunks) {
+        ::operator delete(chunk, std::align_val_t(mChunkAlign));
+    }
+}
+
+std::size_t Archetype::PushRow(Entity entity)
+{
+    const std::size_t row = mSize;
+    if ((row >> mChunkShift) >= mChunks.size()) {
+        mChunks.push_back(static_cast<std::byte*>(::operator new(mChunkBytes, std::align_val_t(mChunkAlign))));
+    }
+
+    reinterpret_cast<Entity*>(mChunks[row >> mChunkShift])[row & ChunkMask()] = entity;
+    ++mSize;
+    return row;
+}
+
+Entity Archetype::RemoveRow(std::size_t row)
+{
+    const std::size_t last = mSize - 1;
+
+    for (ComponentType type : mTypes) {
+        mInfos[type].destroy(ComponentAt(type, row));
+    }
+
+    // Move the last row into the hole to keep chunks dense
+    Entity moved = EntityAt(row);
+    if (row != last) {
+        moved = EntityAt(last);
+        for (ComponentType type : mTypes) {
+            void* lastComponent = ComponentAt(type, last);
+            mInfos[type].moveConstruct(ComponentAt(type, row), lastComponent);
+            mInfos[type].destroy(lastComponent);
+        }
+        reinterpret_cast<Entity*>(mChunks[row >> mChunkShift])[row & ChunkMask()] = moved;
+    }
+    --mSize;
+
+    // Release the trailing chunk once it is empty, keeping one spare to absorb churn
+    const std::size_t usedChunks = (mSize + ChunkMask()) >> mChunkShift;
+    while (mChunks.size() > usedChunks + 1) {
+        ::operator delete(mChunks.back(), std::align_val_t(mChunkAlign));
+        mChunks.pop_back();
+    }
+    return moved;
+}
+
+void ArchetypeStorage::Remove(Entity entity, ComponentType type)
+{
+    if (!Has(entity, type)) {
+        throw std::runtime_error("Removing non-existent component.");
+    }
+
+    MoveEntity(entity, type, false);
+}
+
+void ArchetypeStorage::EntityDestroyed(Entity entity)
+{
+    if (entity >= mLocations.size() || !mLocations[entity].archetype) {
+        return;
+    }
+
+    Location& location = mLocations[entity];
+    Entity moved = location.archetype->RemoveRow(location.row);
+    if (moved != entity) {
+        mLocations[moved].row = location.row;
+    }
+    location = Location{};
+}
+
+ArchetypeStorage::Location ArchetypeStorage::MoveEntity(Entity entity, ComponentType type, bool adding)
+{
+    if (entity >= mLocations.size()) {
+        mLocations.resize(static_cast<std::size_t>(entity) + 1);
+    }
+
+    const Location source = mLocations[entity];
+
+    // Follow the cached edge, or resolve and cache the neighbouring archetype
+    Archetype*& edge = source.archetype
+        ? (adding ? source.archetype->mAddEdges[type] : source.archetype->mRemoveEdges[type])
+        : mRootEdges[type];
+    if (!edge) {
+        Signature signature = source.archetype ? source.archetype->GetSignature() : Signature{};
+        signature.set(type, adding);
+        edge = signature.none() ? nullptr : FindOrCreate(signature);
+    }
+    Archetype* destination = edge;
+
+    Location target;
+    if (destination) {
+        target.archetype = destination;
+        target.row = destination->PushRow(entity);
+    }
+
+    if (source.archetype) {
+        // Relocate shared components, then drop the old row (destroys moved-from leftovers)
+        for (ComponentType shared : source.archetype->GetTypes()) {
+            if (destination && destination->HasColumn(shared)) {
+                mInfos[shared].moveConstruct(destination->ComponentAt(shared, target.row),
+                    source.archetype->ComponentAt(shared, source.row));
+            }
+        }
+        Entity moved = source.archetype->RemoveRow(source.row);
+        if (moved != entity) {
+            mLocations[moved].row = source.row;
+        }
+    }
+
+    mLocations[entity] = target;
+    return target;
+}
+
+Archetype* ArchetypeStorage::FindOrCreate(const Signature& signature)
+{
+    auto it = mArchetypeBySignature.find(signature);
+    if (it != mArchetypeBySignature.end()) {
+        return it->second;
+    }
+
+    mArchetypes.push_back(std::make_unique<Archetype>(signature, mInfos));
+    Archetype* archetype = mArchetypes.back().get();
+    mArchetypeBySignature.insert({signature, archetype});
+    return archetype;
+}
+
+} // namespace ECS
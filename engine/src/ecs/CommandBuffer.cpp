@@ -0,0 +1,80 @@
+#include <ecs/CommandBuffer.hpp>
+#include <algorithm>
+
+namespace ECS {
+
+void CommandBuffer::Flush()
+{
+    if (mCommands.empty()) {
+        return;
+    }
+
+    // Detach the batch first so the buffer is reusable even if a command throws
+    std::vector<Command> commands = std::move(mCommands);
+    mCommands.clear();
+    mPendingDestroys.Clear();
+
+    // Group by entity; stable so each entity keeps its recording order
+    std::stable_sort(commands.begin(), commands.end(),
+        [](const Command& a, const Command& b) { return a.handle.index < b.handle.index; });
+
+    auto first = commands.begin();
+    while (first != commands.end()) {
+        auto last = std::find_if(first, commands.end(),
+            [entity = first->handle.index](const Command& command) { return command.handle.index != entity; });
+        ApplyRun(first, last);
+        first = last;
+    }
+}
+
+void CommandBuffer::ApplyRun(std::vector<Command>::iterator first, std::vector<Command>::iterator last)
+{
+    const Entity entity = first->handle.index;
+
+    // Commands recorded against an entity destroyed directly since then (its ID
+    // maybe reused by a new entity) have nothing left to apply to
+    auto current = [this](const Command& command) { return mCoordinator->IsAlive(command.handle); };
+    if (std::none_of(first, last, current)) {
+        return;
+    }
+
+    bool destroyed = std::any_of(first, last,
+        [&](const Command& command) { return command.kind == Kind::Destroy && current(command); });
+    if (destroyed) {
+        mCoordinator->DestroyEntity(entity);
+        return;
+    }
+
+    ComponentManager& components = *mCoordinator->mComponentManager;
+    const Signature oldSignature = mCoordinator->mEntityManager->GetSignature(entity);
+    Signature signature = oldSignature;
+
+    // Publish whatever was applied, even when a command throws midway
+    auto publish = [&]() {
+        if (signature != oldSignature) {
+            mCoordinator->mEntityManager->SetSignature(entity, signature);
+            mCoordinator->mSystemManager->EntitySignatureChanged(entity, oldSignature, signature);
+        }
+    };
+
+    try {
+        for (auto it = first; it != last; ++it) {
+            if (!current(*it)) {
+                continue;
+            }
+            if (it->kind == Kind::Add) {
+                it->component->AddTo(components, entity);
+                signature.set(it->type, true);
+            } else {
+                it->remove(components, entity);
+                signature.set(it->type, false);
+            }
+        }
+    } catch (...) {
+        publish();
+        throw;
+    }
+    publish();
+}
+
+} // namespace ECS
@@ -4,11 +4,16 @@ namespace ECS {
 
 void ComponentManager::EntityDestroyed(Entity entity)
 {
+    if (mArchetypes) {
+        // The entity's whole row goes at once
+        mArchetypes->EntityDestroyed(entity);
+        return;
+    }
+
     // Notify each component array that an entity has been destroyed
     // If it has a component for that entity, it will remove it
-    for (auto const& pair : mComponentArrays) {
-        auto const& component = pair.second;
-        component->EntityDestroyed(entity);
+    for (ComponentType type = 0; type < mNextComponentType; ++type) {
+        mComponentArrays[type]->EntityDestroyed(entity);
     }
 }
 
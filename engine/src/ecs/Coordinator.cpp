@@ -3,11 +3,11 @@
 
 namespace ECS {
 
-void Coordinator::Init()
+void Coordinator::Init(StorageMode mode, Entity maxEntities)
 {
     // Create pointers to each manager
-    mComponentManager = std::make_unique<ComponentManager>();
-    mEntityManager = std::make_unique<EntityManager>();
+    mComponentManager = std::make_unique<ComponentManager>(mode);
+    mEntityManager = std::make_unique<EntityManager>(maxEntities);
     mSystemManager = std::make_unique<SystemManager>();
 }
 
@@ -24,11 +24,45 @@ Entity Coordinator::CreateEntity()
 
 void Coordinator::DestroyEntity(Entity entity)
 {
+    // A repeated destroy would queue the ID twice for reuse
+    if (!mEntityManager->IsAlive(entity)) {
+        return;
+    }
+
     mEntityManager->DestroyEntity(entity);
     mComponentManager->EntityDestroyed(entity);
     mSystemManager->EntityDestroyed(entity);
 }
 
+EntityHandle Coordinator::CreateHandle()
+{
+    return mEntityManager->GetHandle(mEntityManager->CreateEntity());
+}
+
+EntityHandle Coordinator::GetHandle(Entity entity) const
+{
+    return mEntityManager->GetHandle(entity);
+}
+
+bool Coordinator::IsAlive(Entity entity) const
+{
+    return mEntityManager->IsAlive(entity);
+}
+
+bool Coordinator::IsAlive(EntityHandle handle) const
+{
+    return mEntityManager->IsAlive(handle);
+}
+
+bool Coordinator::DestroyEntity(EntityHandle handle)
+{
+    if (!mEntityManager->IsAlive(handle)) {
+        return false;
+    }
+    DestroyEntity(handle.index);
+    return true;
+}
+
 Signature Coordinator::GetEntitySignature(Entity entity) const
 {
     return mEntityManager->GetSignature(entity);
@@ -39,6 +73,16 @@ std::uint32_t Coordinator::GetLivingEntityCount() const
     return mEntityManager->GetLivingEntityCount();
 }
 
+void Coordinator::SetMaxEntities(Entity maxEntities)
+{
+    mEntityManager->SetMaxEntities(maxEntities);
+}
+
+Entity Coordinator::GetMaxEntities() const
+{
+    return mEntityManager->GetMaxEntities();
+}
+
 void Coordinator::SetNetworkId(Entity entity, NetworkId networkId)
 {
     mEntityManager->SetNetworkId(entity, networkId);
@@ -3,24 +3,33 @@
 
 namespace ECS {
 
-EntityManager::EntityManager()
-    : mLivingEntityCount(0)
+EntityManager::EntityManager(Entity maxEntities)
+    : mMaxEntities(maxEntities)
+    , mLivingEntityCount(0)
 {
-    // Initialize the queue with all possible entity IDs
-    for (Entity entity = 0; entity < MAX_ENTITIES; ++entity) {
-        mAvailableEntities.push(entity);
-    }
 }
 
 Entity EntityManager::CreateEntity()
 {
-    if (mLivingEntityCount >= MAX_ENTITIES) {
+    if (mLivingEntityCount >= mMaxEntities) {
         throw std::runtime_error("Too many entities in existence.");
     }
 
-    // Take an ID from the front of the queue
-    Entity id = mAvailableEntities.front();
-    mAvailableEntities.pop();
+    Entity id;
+    if (mAvailableEntities.size() >= MIN_FREE_ENTITIES || mNextEntity == NULL_ENTITY) {
+        // Take an ID from the front of the queue (never empty once every ID was issued)
+        id = mAvailableEntities.front();
+        mAvailableEntities.pop();
+    } else {
+        // Fresh ID, starting a new page of records when crossing a boundary
+        id = mNextEntity++;
+        if (id % SPARSE_PAGE_SIZE == 0) {
+            mPages.push_back(Pool::Shared().Acquire());
+            mPages.back()->fill(Record{Signature{}, 0, false});
+        }
+    }
+
+    At(id).alive = true;
     ++mLivingEntityCount;
 
     return id;
@@ -28,7 +37,8 @@ Entity EntityManager::CreateEntity()
 
 void EntityManager::DestroyEntity(Entity entity)
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
+    assert(At(entity).alive && "Destroying an entity that is not alive.");
 
     // Remove network ID mapping if it exists
     if (mEntityToNetworkId.find(entity) != mEntityToNetworkId.end()) {
@@ -38,7 +48,12 @@ void EntityManager::DestroyEntity(Entity entity)
     }
 
     // Invalidate the destroyed entity's signature
-    mSignatures[entity].reset();
+    Record& record = At(entity);
+    record.signature.reset();
+
+    // Outstanding handles to this slot become stale
+    record.alive = false;
+    ++record.version;
 
     // Put the destroyed ID at the back of the queue
     mAvailableEntities.push(entity);
@@ -47,18 +62,18 @@ void EntityManager::DestroyEntity(Entity entity)
 
 void EntityManager::SetSignature(Entity entity, Signature signature)
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
 
-    // Put this entity's signature into the array
-    mSignatures[entity] = signature;
+    // Put this entity's signature into its record
+    At(entity).signature = signature;
 }
 
 Signature EntityManager::GetSignature(Entity entity) const
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
 
-    // Get this entity's signature from the array
-    return mSignatures[entity];
+    // Get this entity's signature from its record
+    return At(entity).signature;
 }
 
 std::uint32_t EntityManager::GetLivingEntityCount() const
@@ -66,9 +81,39 @@ std::uint32_t EntityManager::GetLivingEntityCount() const
     return mLivingEntityCount;
 }
 
+void EntityManager::SetMaxEntities(Entity maxEntities)
+{
+    if (maxEntities < mLivingEntityCount) {
+        throw std::runtime_error("Entity cap below the number of living entities.");
+    }
+    mMaxEntities = maxEntities;
+}
+
+bool EntityManager::IsAlive(Entity entity) const
+{
+    return entity < mNextEntity && At(entity).alive;
+}
+
+bool EntityManager::IsAlive(EntityHandle handle) const
+{
+    if (handle.index >= mNextEntity) {
+        return false;
+    }
+    const Record& record = At(handle.index);
+    return record.alive && record.version == handle.version;
+}
+
+EntityHandle EntityManager::GetHandle(Entity entity) const
+{
+    if (!IsAlive(entity)) {
+        throw std::runtime_error("Taking a handle to an entity that is not alive.");
+    }
+    return EntityHandle{entity, At(entity).version};
+}
+
 void EntityManager::SetNetworkId(Entity entity, NetworkId networkId)
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
     assert(networkId != INVALID_NETWORK_ID && "Cannot set invalid network ID.");
     
     if (mNetworkIdToEntity.find(networkId) != mNetworkIdToEntity.end()) {
@@ -87,7 +132,7 @@ void EntityManager::SetNetworkId(Entity entity, NetworkId networkId)
 
 NetworkId EntityManager::GetNetworkId(Entity entity) const
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
     
     auto it = mEntityToNetworkId.find(entity);
     if (it == mEntityToNetworkId.end()) {
@@ -99,7 +144,7 @@ NetworkId EntityManager::GetNetworkId(Entity entity) const
 
 bool EntityManager::HasNetworkId(Entity entity) const
 {
-    assert(entity < MAX_ENTITIES && "Entity out of range.");
+    assert(entity < mNextEntity && "Entity out of range.");
     return mEntityToNetworkId.find(entity) != mEntityToNetworkId.end();
 }
 
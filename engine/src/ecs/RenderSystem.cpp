@@ -99,7 +99,7 @@ namespace ECS {
 
     std::vector<Entity> RenderSystem::GetSortedEntitiesByLayer() {
         // Copy entities to a vector for sorting
-        std::vector<Entity> entities(mEntities.begin(), mEntities.end());
+        std::vector<Entity> entities = mEntities.Dense();
         
         // Sort by layer (lower layer = drawn first = background)
         std::sort(entities.begin(), entities.end(), [this](Entity a, Entity b) {
@@ -1,42 +1,84 @@
 #include <ecs/SystemManager.hpp>
+#include <algorithm>
+#include <bit>
 
 namespace ECS {
 
+static_assert(MAX_COMPONENTS <= 64, "Signature bits are walked through a 64-bit word.");
+
 void SystemManager::EntityDestroyed(Entity entity)
 {
-    // Erase a destroyed entity from all system lists
-    // mEntities is a set so no check needed
-    for (auto const& pair : mSystems) {
-        auto const& system = pair.second;
-        system->mEntities.erase(entity);
+    // Systems may also hold entities added by hand (AddEntityToSystem)
+    // whatever their signature, so every list is checked; erase is O(1)
+    for (auto const& system : mSystems) {
+        system->Leave(entity);
     }
 }
 
-void SystemManager::EntitySignatureChanged(Entity entity, Signature entitySignature)
+void SystemManager::EntitySignatureChanged(Entity entity, Signature oldSignature, Signature newSignature)
 {
-    // Notify each system that an entity's signature changed
-    for (auto const& pair : mSystems) {
-        auto const& type = pair.first;
-        auto const& system = pair.second;
-        auto const& systemSignature = mSignatures[type];
-
-        // Entity signature matches system signature - insert into set
-        if ((entitySignature & systemSignature) == systemSignature) {
-            system->mEntities.insert(entity);
-        }
-        // Entity signature does not match system signature - erase from set
-        else {
-            system->mEntities.erase(entity);
+    // Only systems requiring a flipped component can change their mind
+    std::uint64_t changed = (oldSignature ^ newSignature).to_ullong();
+    while (changed != 0) {
+        const int type = std::countr_zero(changed);
+        changed &= changed - 1;
+
+        for (std::size_t index : mSystemsByComponent[type]) {
+            UpdateMembership(index, entity, newSignature);
         }
     }
+
+    for (std::size_t index : mMatchAllSystems) {
+        mSystems[index]->Join(entity);
+    }
 }
 
 void SystemManager::ShutdownAll()
 {
-    for (auto const& pair : mSystems) {
-        auto const& system = pair.second;
+    for (auto const& system : mSystems) {
         system->Shutdown();
     }
 }
 
+void SystemManager::IndexSystem(std::size_t index)
+{
+    const Signature& signature = mSignatures[index];
+    if (signature.none()) {
+        mMatchAllSystems.push_back(index);
+        return;
+    }
+
+    for (ComponentType type = 0; type < MAX_COMPONENTS; ++type) {
+        if (signature.test(type)) {
+            mSystemsByComponent[type].push_back(index);
+        }
+    }
+}
+
+void SystemManager::UnindexSystem(std::size_t index)
+{
+    auto drop = [index](std::vector<std::size_t>& list) {
+        list.erase(std::remove(list.begin(), list.end(), index), list.end());
+    };
+
+    drop(mMatchAllSystems);
+    for (auto& list : mSystemsByComponent) {
+        drop(list);
+    }
+}
+
+void SystemManager::UpdateMembership(std::size_t index, Entity entity, const Signature& entitySignature)
+{
+    auto const& systemSignature = mSignatures[index];
+
+    // Entity signature matches system signature - insert into list
+    if ((entitySignature & systemSignature) == systemSignature) {
+        mSystems[index]->Join(entity);
+    }
+    // Entity signature does not match system signature - erase from list
+    else {
+        mSystems[index]->Leave(entity);
+    }
+}
+
 } // namespace ECS
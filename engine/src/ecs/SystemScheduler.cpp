@@ -0,0 +1,116 @@
+#include <ecs/SystemScheduler.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ECS {
+
+SystemScheduler::~SystemScheduler()
+{
+    for (auto& node : mNodes) {
+        node.system->mScheduled = false;
+    }
+}
+
+SystemScheduler::Registration SystemScheduler::Add(std::shared_ptr<System> system)
+{
+    if (!system) {
+        throw std::runtime_error("Scheduling a null system.");
+    }
+
+    system->mScheduled = true;
+    Node node;
+    node.system = std::move(system);
+    mNodes.push_back(std::move(node));
+    mDirty = true;
+    return Registration(*this, mNodes.size() - 1);
+}
+
+void SystemScheduler::Run(float dt)
+{
+    if (mNodes.empty()) {
+        return;
+    }
+    if (mDirty) {
+        Build();
+    }
+
+    if (!mPool || mPool->WorkerCount() == 0) {
+        // Registration order is a valid topological order of the DAG
+        for (auto& node : mNodes) {
+            node.system->Update(dt);
+        }
+    } else {
+        for (std::size_t i = 0; i < mNodes.size(); ++i) {
+            mRemaining[i].store(mNodes[i].predecessorCount, std::memory_order_relaxed);
+        }
+
+        TaskGroup group;
+        for (std::size_t i = 0; i < mNodes.size(); ++i) {
+            if (mNodes[i].predecessorCount == 0) {
+                Launch(i, dt, group);
+            }
+        }
+        mPool->Wait(group);
+    }
+
+    // Sync point: structural changes land in a deterministic order
+    for (auto& node : mNodes) {
+        node.system->ApplyDeferred();
+    }
+}
+
+bool SystemScheduler::DependsOn(std::size_t later, std::size_t earlier)
+{
+    if (mDirty) {
+        Build();
+    }
+
+    const auto& successors = mNodes[earlier].successors;
+    return std::find(successors.begin(), successors.end(), later) != successors.end();
+}
+
+bool SystemScheduler::Conflicts(const Node& a, const Node& b)
+{
+    if (a.exclusive || b.exclusive) {
+        return true;
+    }
+    return (a.writes & (b.reads | b.writes)).any() || (b.writes & a.reads).any();
+}
+
+void SystemScheduler::Build()
+{
+    for (auto& node : mNodes) {
+        node.successors.clear();
+        node.predecessorCount = 0;
+    }
+
+    // Edges only point forward, so the graph is acyclic by construction
+    for (std::size_t i = 0; i < mNodes.size(); ++i) {
+        for (std::size_t j = i + 1; j < mNodes.size(); ++j) {
+            if (Conflicts(mNodes[i], mNodes[j])) {
+                mNodes[i].successors.push_back(j);
+                ++mNodes[j].predecessorCount;
+            }
+        }
+    }
+
+    mRemaining = std::make_unique<std::atomic<std::size_t>[]>(mNodes.size());
+    mDirty = false;
+}
+
+void SystemScheduler::Launch(std::size_t index, float dt, TaskGroup& group)
+{
+    mPool->Submit(group, [this, index, dt, &group]() {
+        Node& node = mNodes[index];
+        node.system->Update(dt);
+
+        // The last finished predecessor releases each successor
+        for (std::size_t successor : node.successors) {
+            if (mRemaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Launch(successor, dt, group);
+            }
+        }
+    });
+}
+
+} // namespace ECS
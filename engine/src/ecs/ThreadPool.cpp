@@ -0,0 +1,161 @@
+#include <ecs/ThreadPool.hpp>
+#include <algorithm>
+
+namespace ECS {
+
+namespace {
+
+// Identifies the pool (and queue) owned by the current worker thread
+thread_local const ThreadPool* tCurrentPool = nullptr;
+thread_local std::size_t tWorkerIndex = 0;
+
+} // namespace
+
+std::size_t ThreadPool::DefaultWorkerCount()
+{
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+ThreadPool::ThreadPool(std::size_t workerCount)
+{
+    // Without workers the caller still needs a queue to run from
+    const std::size_t queueCount = std::max<std::size_t>(workerCount, 1);
+    for (std::size_t i = 0; i < queueCount; ++i) {
+        mQueues.push_back(std::make_unique<Queue>());
+    }
+
+    mWorkers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        mWorkers.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping.store(true);
+    }
+    mWake.notify_all();
+
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Submit(TaskGroup& group, Task task)
+{
+    group.mPending.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t index = (tCurrentPool == this)
+        ? tWorkerIndex
+        : mNextQueue.fetch_add(1, std::memory_order_relaxed) % mQueues.size();
+    {
+        std::lock_guard<std::mutex> lock(mQueues[index]->mutex);
+        mQueues[index]->jobs.push_back(Job{std::move(task), &group});
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mQueued.fetch_add(1, std::memory_order_release);
+    }
+    mWake.notify_one();
+}
+
+void ThreadPool::Wait(TaskGroup& group)
+{
+    const std::size_t preferred = (tCurrentPool == this) ? tWorkerIndex : 0;
+
+    while (!group.Done()) {
+        Job job;
+        if (TryPop(preferred, job)) {
+            Run(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mGroupDone.wait(lock, [&]() {
+            return group.Done() || mQueued.load(std::memory_order_acquire) > 0;
+        });
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(group.mErrorMutex);
+        std::swap(error, group.mError);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::WorkerLoop(std::size_t index)
+{
+    tCurrentPool = this;
+    tWorkerIndex = index;
+
+    while (true) {
+        Job job;
+        if (TryPop(index, job)) {
+            Run(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mWake.wait(lock, [this]() {
+            return mStopping.load() || mQueued.load(std::memory_order_acquire) > 0;
+        });
+        if (mStopping.load() && mQueued.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::TryPop(std::size_t preferred, Job& job)
+{
+    // Own queue first, newest task (still warm in cache)
+    {
+        Queue& own = *mQueues[preferred];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            mQueued.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of another queue
+    for (std::size_t offset = 1; offset < mQueues.size(); ++offset) {
+        Queue& victim = *mQueues[(preferred + offset) % mQueues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            mQueued.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::Run(Job& job)
+{
+    TaskGroup& group = *job.group;
+    try {
+        job.task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(group.mErrorMutex);
+        if (!group.mError) {
+            group.mError = std::current_exception();
+        }
+    }
+
+    if (group.mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mGroupDone.notify_all();
+    }
+}
+
+} // namespace ECS
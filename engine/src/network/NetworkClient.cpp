@@ -37,10 +37,17 @@ void NetworkClient::start() {
 
 void NetworkClient::process() {
     // Process received packets from UdpClient
-    NetworkPacket packet;
-    while (client_.popPacket(packet)) {
-        std::lock_guard<std::mutex> lock(packetsMutex_);
-        receivedPackets_.push(packet);
+    // Everything received since the last call, in one pass over the ring
+    std::lock_guard<std::mutex> lock(packetsMutex_);
+    client_.popPackets(receivedPackets_);
+
+    const Network::QueueStats inbound = client_.getInboundStats();
+    const Network::QueueStats outbound = client_.getOutboundStats();
+    if (inbound.dropped != reportedInboundDrops_ || outbound.dropped != reportedOutboundDrops_) {
+        LOG_WARNING("NETWORKCLIENT", "Dropped " + std::to_string(inbound.dropped - reportedInboundDrops_) + " incoming and "
+            + std::to_string(outbound.dropped - reportedOutboundDrops_) + " outgoing packets");
+        reportedInboundDrops_ = inbound.dropped;
+        reportedOutboundDrops_ = outbound.dropped;
     }
 }
 
@@ -96,16 +103,19 @@ void NetworkClient::sendHello() {
 
 bool NetworkClient::hasReceivedPackets() {
     std::lock_guard<std::mutex> lock(packetsMutex_);
-    return !receivedPackets_.empty();
+    return receivedHead_ < receivedPackets_.size();
 }
 
-NetworkPacket NetworkClient::getNextReceivedPacket() {
+PacketView NetworkClient::getNextReceivedPacket() {
     std::lock_guard<std::mutex> lock(packetsMutex_);
-    if (receivedPackets_.empty()) {
+    if (receivedHead_ >= receivedPackets_.size()) {
         throw std::runtime_error("No packets available");
     }
-    NetworkPacket packet = receivedPackets_.front();
-    receivedPackets_.pop();
+    PacketView packet = std::move(receivedPackets_[receivedHead_++]);
+    if (receivedHead_ == receivedPackets_.size()) {
+        receivedPackets_.clear();
+        receivedHead_ = 0;
+    }
     return packet;
 }
 
@@ -24,10 +24,15 @@ void NetworkServer::start() {
 }
 
 void NetworkServer::process() {
-    NetworkPacket packet;
-    udp::endpoint sender;
+    // Everything received since the last call, in one pass over the ring
+    incoming_.clear();
+    server_.popPackets(incoming_);
+    reportDrops();
+
+    for (auto& entry : incoming_) {
+        PacketView& packet = entry.first;
+        const udp::endpoint& sender = entry.second;
 
-    while (server_.popPacket(packet, sender)) {
         auto session = server_.getSession(sender);
         if (!session) {
             LOG_WARNING("NETWORKSERVER", "WARNING: No session found for " + (sender.address().to_string() + ":" + std::to_string(sender.port())) + " - skipping packet");
@@ -151,25 +156,42 @@ void NetworkServer::process() {
         }
         else {
             std::lock_guard<std::mutex> lock(packetsMutex_);
-            receivedPackets_.push({packet, sender});
+            receivedPackets_.emplace_back(std::move(packet), sender);
         }
     }
+    incoming_.clear();
 
     server_.checkTimeouts();
 }
 
+void NetworkServer::reportDrops() {
+    const Network::QueueStats inbound = server_.getInboundStats();
+    const Network::QueueStats outbound = server_.getOutboundStats();
+    if (inbound.dropped != reportedInboundDrops_ || outbound.dropped != reportedOutboundDrops_) {
+        LOG_WARNING("NETWORKSERVER", "Dropped " + std::to_string(inbound.dropped - reportedInboundDrops_) + " incoming and "
+            + std::to_string(outbound.dropped - reportedOutboundDrops_) + " outgoing packets (queues "
+            + std::to_string(inbound.depth) + "/" + std::to_string(inbound.capacity) + " in, "
+            + std::to_string(outbound.depth) + "/" + std::to_string(outbound.capacity) + " out)");
+        reportedInboundDrops_ = inbound.dropped;
+        reportedOutboundDrops_ = outbound.dropped;
+    }
+}
+
 bool NetworkServer::hasReceivedPackets() {
     std::lock_guard<std::mutex> lock(packetsMutex_);
-    return !receivedPackets_.empty();
+    return receivedHead_ < receivedPackets_.size();
 }
 
-std::pair<NetworkPacket, asio::ip::udp::endpoint> NetworkServer::getNextReceivedPacket() {
+std::pair<PacketView, asio::ip::udp::endpoint> NetworkServer::getNextReceivedPacket() {
     std::lock_guard<std::mutex> lock(packetsMutex_);
-    if (receivedPackets_.empty()) {
+    if (receivedHead_ >= receivedPackets_.size()) {
         throw std::runtime_error("No packets available");
     }
-    auto packet = receivedPackets_.front();
-    receivedPackets_.pop();
+    auto packet = std::move(receivedPackets_[receivedHead_++]);
+    if (receivedHead_ == receivedPackets_.size()) {
+        receivedPackets_.clear();
+        receivedHead_ = 0;
+    }
     return packet;
 }
 
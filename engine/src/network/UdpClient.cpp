@@ -1,5 +1,6 @@
 #include "network/UdpClient.hpp"
 #include "core/Logger.hpp"
+#include <cstring>
 #include <sstream>
 
 UdpClient::UdpClient(asio::io_context& io_context, const std::string& serverAddress, short serverPort)
@@ -10,6 +11,8 @@ UdpClient::UdpClient(asio::io_context& io_context, const std::string& serverAddr
     udp::resolver resolver(io_context);
     auto endpoints = resolver.resolve(udp::v4(), serverAddress, std::to_string(serverPort));
     serverEndpoint_ = *endpoints.begin();
+    // The I/O thread sends synchronously from flushOutbound(): never let it block
+    socket_.non_blocking(true);
     
     connected_ = true;
     LOG_INFO("UDPCLIENT", "Initialized. Server: " + ([&](){std::ostringstream _ss; _ss << serverEndpoint_; return _ss.str();})());
@@ -35,36 +38,60 @@ void UdpClient::start() {
 void UdpClient::send(const NetworkPacket& packet) {
     if (!socket_.is_open()) return;
     try {
-        auto buffer = packet.serialize();
+        auto bytes = packet.serializeCompressed();
         LOG_INFO("UDPCLIENT", "Sending packet type " + std::to_string(packet.header.type)
-                  + " (" + std::to_string(buffer.size()) + " bytes) to " + ([&](){std::ostringstream _ss; _ss << serverEndpoint_; return _ss.str();})());
-        socket_.async_send_to(
-            asio::buffer(buffer),
-            serverEndpoint_,
-            [this](const std::error_code& error, std::size_t bytes_transferred) {
-                handleSend(error, bytes_transferred);
-            }
-        );
+                  + " (" + std::to_string(bytes.size()) + " bytes) to " + ([&](){std::ostringstream _ss; _ss << serverEndpoint_; return _ss.str();})());
+        Network::PacketRef buffer = sendPool_.acquire();
+        if (!buffer || bytes.size() > buffer->capacity()) {
+            outbound_.recordDrop();
+            return;
+        }
+        std::memcpy(buffer->data(), bytes.data(), bytes.size());
+        buffer->setSize(bytes.size());
+        if (outbound_.tryPush(std::move(buffer))) {
+            scheduleFlush();
+        }
     } catch (const std::exception& e) {
         LOG_ERROR("UDPCLIENT", std::string("Send error: ") + e.what());
     }
 }
 
-bool UdpClient::popPacket(NetworkPacket& outPacket) {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    if (packetQueue_.empty()) {
-        return false;
+void UdpClient::scheduleFlush() {
+    if (flushSignal_.request()) {
+        asio::post(socket_.get_executor(), [this]() { flushOutbound(); });
     }
-    outPacket = packetQueue_.front();
-    packetQueue_.pop();
-    return true;
+}
+
+void UdpClient::flushOutbound() {
+    // Cleared first: a packet queued during the flush schedules another one
+    flushSignal_.begin();
+    outbound_.consume([this](Network::PacketRef&& buffer) {
+        asio::error_code error;
+        const size_t sent = socket_.is_open()
+            ? socket_.send_to(asio::buffer(buffer->data(), buffer->size()), serverEndpoint_, 0, error)
+            : 0;
+        if (error || !socket_.is_open()) {
+            outbound_.recordDrop();
+        }
+        handleSend(error, sent);
+        buffer.reset();
+    });
+}
+
+bool UdpClient::popPacket(PacketView& outPacket) {
+    return inbound_.tryPop(outPacket);
 }
 
 void UdpClient::startReceive() {
     if (!socket_.is_open()) return;
+    if (!recvBuffer_) {
+        recvBuffer_ = bufferPool_.acquire();
+    }
+    auto buffer = recvBuffer_ ? asio::buffer(recvBuffer_->data(), recvBuffer_->capacity())
+                              : asio::buffer(overflowBuffer_);
     socket_.async_receive_from(
-        asio::buffer(recvBuffer_),
-        serverEndpoint_,
+        buffer,
+        senderEndpoint_,
         [this](const std::error_code& error, std::size_t bytes_transferred) {
             handleReceive(error, bytes_transferred);
         }
@@ -82,9 +109,12 @@ void UdpClient::handleReceive(const std::error_code& error, std::size_t bytes_tr
         return;
     }
 
-    if (bytes_transferred > 0) {
+    if (!recvBuffer_) {
+        inbound_.recordDrop(); // Every buffer is still held by the game
+    } else if (bytes_transferred > 0) {
         try {
-            NetworkPacket packet = NetworkPacket::deserialize(recvBuffer_.data(), bytes_transferred);
+            recvBuffer_->setSize(bytes_transferred);
+            PacketView packet = PacketView::parse(std::move(recvBuffer_), bufferPool_);
             
             // Validate magic number
             if (packet.header.magic != 0x5254) {
@@ -93,11 +123,8 @@ void UdpClient::handleReceive(const std::error_code& error, std::size_t bytes_tr
                 return;
             }
 
-            // Add to queue
-            {
-                std::lock_guard<std::mutex> lock(queueMutex_);
-                packetQueue_.push(packet);
-            }
+            // Add to queue (counted as a drop when the game is too far behind)
+            inbound_.tryPush(std::move(packet));
 
         } catch (const std::exception& e) {
             LOG_ERROR("UDPCLIENT", std::string("Receive parse error: ") + e.what());
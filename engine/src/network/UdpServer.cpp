@@ -1,9 +1,12 @@
 #include "../../include/network/UdpServer.hpp"
 #include "core/Logger.hpp"
+#include <cstring>
 #include <sstream>
 
 UdpServer::UdpServer(asio::io_context& io_context, short port)
     : socket_(io_context, udp::endpoint(udp::v4(), port)) {
+    // The I/O thread sends synchronously from flushOutbound(): never let it block
+    socket_.non_blocking(true);
 }
 
 UdpServer::~UdpServer() {
@@ -15,54 +18,60 @@ void UdpServer::start() {
 }
 
 void UdpServer::startReceive() {
+    if (!recvBuffer_) {
+        recvBuffer_ = bufferPool_.acquire();
+    }
+    auto buffer = recvBuffer_ ? asio::buffer(recvBuffer_->data(), recvBuffer_->capacity())
+                              : asio::buffer(overflowBuffer_);
     socket_.async_receive_from(
-        asio::buffer(recvBuffer_), receiverEndpoint_,
+        buffer, receiverEndpoint_,
         [this](const std::error_code& error, std::size_t bytes_transferred) {
             handleReceive(error, bytes_transferred);
         });
 }
 
+// I/O thread: no lock and no logging per packet, drops are counted in inbound_
 void UdpServer::handleReceive(const std::error_code& error, std::size_t bytes_transferred) {
-    if (!error) {
+    if (error) {
+        LOG_ERROR("SERVER", std::string("Receive error: ") + error.message());
+    } else if (!recvBuffer_) {
+        inbound_.recordDrop(); // Every buffer is still held by the game
+    } else if (bytes_transferred >= recvBuffer_->capacity()) {
+        inbound_.recordDrop(); // Larger than any client message, possibly truncated
+    } else {
         try {
-            NetworkPacket packet = NetworkPacket::deserialize(recvBuffer_.data(), bytes_transferred);
+            recvBuffer_->setSize(bytes_transferred);
+            PacketView packet = PacketView::parse(std::move(recvBuffer_), inflatePool_);
 
             if (packet.header.magic != 0x5254 || packet.header.version != 1) {
                 // Invalid packet, ignore
             } else {
-                handleClientSession(receiverEndpoint_, packet);
-
-                std::lock_guard<std::mutex> lock(queueMutex_);
-                packetQueue_.push({packet, receiverEndpoint_});
+                inbound_.tryPush({std::move(packet), receiverEndpoint_});
             }
 
         } catch (const std::exception& e) {
             LOG_ERROR("SERVER", std::string("Error parsing packet: ") + e.what());
         }
-    } else {
-        LOG_ERROR("SERVER", std::string("Receive error: ") + error.message());
     }
 
     // Continue listening
     startReceive();
 }
 
-void UdpServer::handleClientSession(const udp::endpoint& sender, const NetworkPacket& packet) {
-    std::stringstream ss;
-    ss << sender;
-    std::string key = ss.str();
-
+void UdpServer::handleClientSession(const udp::endpoint& sender, const PacketHeader& header) {
     std::lock_guard<std::mutex> lock(sessionsMutex_);
-    auto it = sessions_.find(key);
+    auto it = sessions_.find(sender);
 
     if (it == sessions_.end()) {
         // New Client
         // Only accept if it's a CLIENT_HELLO (strict mode) or just accept implicitely (loose mode)
         // For robustness, usually we wait for HELLO, but for now we auto-add.
         
-        LOG_INFO("SERVER", "New session: " + key + " (ID: " + std::to_string((int)nextPlayerId_) + ")");
+        std::stringstream ss;
+        ss << sender;
+        LOG_INFO("SERVER", "New session: " + ss.str() + " (ID: " + std::to_string((int)nextPlayerId_) + ")");
         auto session = std::make_shared<ClientSession>(sender, nextPlayerId_++);
-        sessions_[key] = session;
+        sessions_[sender] = session;
         
         // Auto-reply Welcome could go here or in main loop
     } else {
@@ -70,42 +79,88 @@ void UdpServer::handleClientSession(const udp::endpoint& sender, const NetworkPa
         it->second->updateLastPacketTime();
         
         // Simple Seq check (can be advanced to drop duplicates)
-        if (packet.header.seq > it->second->lastSequenceNumber) {
-            it->second->lastSequenceNumber = packet.header.seq;
+        if (header.seq > it->second->lastSequenceNumber) {
+            it->second->lastSequenceNumber = header.seq;
         }
     }
 }
 
-bool UdpServer::popPacket(NetworkPacket& outPacket, udp::endpoint& outSender) {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    if (packetQueue_.empty()) {
+bool UdpServer::popPacket(PacketView& outPacket, udp::endpoint& outSender) {
+    std::pair<PacketView, udp::endpoint> entry;
+    if (!inbound_.tryPop(entry)) {
         return false;
     }
-    auto front = packetQueue_.front();
-    packetQueue_.pop();
-    outPacket = front.first;
-    outSender = front.second;
+    handleClientSession(entry.second, entry.first.header);
+    outPacket = std::move(entry.first);
+    outSender = entry.second;
     return true;
 }
 
-void UdpServer::sendTo(const NetworkPacket& packet, const udp::endpoint& endpoint) {
-    auto buffer = packet.serialize();
-    socket_.async_send_to(asio::buffer(buffer), endpoint,
-        [](const std::error_code& /*error*/, std::size_t /*bytes_transferred*/) {
+size_t UdpServer::popPackets(std::vector<std::pair<PacketView, udp::endpoint>>& out) {
+    const size_t first = out.size();
+    const size_t count = inbound_.popBatch(out);
+    for (size_t i = first; i < out.size(); ++i) {
+        handleClientSession(out[i].second, out[i].first.header);
+    }
+    return count;
+}
 
-        });
+Network::PacketRef UdpServer::serializeForSend(const NetworkPacket& packet) {
+    auto bytes = packet.serializeCompressed();
+    Network::PacketBufferPool& pool = bytes.size() <= sendPool_.bufferSize() ? sendPool_ : largeSendPool_;
+    Network::PacketRef buffer = pool.acquire();
+    if (!buffer || bytes.size() > buffer->capacity()) {
+        return Network::PacketRef();
+    }
+    std::memcpy(buffer->data(), bytes.data(), bytes.size());
+    buffer->setSize(bytes.size());
+    return buffer;
+}
+
+void UdpServer::scheduleFlush() {
+    if (flushSignal_.request()) {
+        asio::post(socket_.get_executor(), [this]() { flushOutbound(); });
+    }
+}
+
+void UdpServer::flushOutbound() {
+    // Cleared first: a packet queued during the flush schedules another one
+    flushSignal_.begin();
+    outbound_.consume([this](OutgoingPacket&& outgoing) {
+        asio::error_code error;
+        socket_.send_to(asio::buffer(outgoing.buffer->data(), outgoing.buffer->size()), outgoing.endpoint, 0, error);
+        if (error) {
+            outbound_.recordDrop(); // Socket buffer full (would_block) or unreachable peer
+        }
+        outgoing.buffer.reset();
+    });
+}
+
+void UdpServer::sendTo(const NetworkPacket& packet, const udp::endpoint& endpoint) {
+    Network::PacketRef buffer = serializeForSend(packet);
+    if (!buffer) {
+        outbound_.recordDrop();
+        return;
+    }
+    if (outbound_.tryPush({std::move(buffer), endpoint})) {
+        scheduleFlush();
+    }
 }
 
 void UdpServer::broadcast(const NetworkPacket& packet) {
+    Network::PacketRef buffer = serializeForSend(packet);
+    if (!buffer) {
+        outbound_.recordDrop();
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(sessionsMutex_);
-    auto buffer = packet.serialize();
-    
     for (const auto& pair : sessions_) {
         if (pair.second->isConnected) {
-            socket_.async_send_to(asio::buffer(buffer), pair.second->endpoint,
-                [](const std::error_code&, std::size_t) {});
+            outbound_.tryPush({buffer, pair.second->endpoint});
         }
     }
+    scheduleFlush();
 }
 
 void UdpServer::checkTimeouts() {
@@ -116,7 +171,9 @@ void UdpServer::checkTimeouts() {
 
     for (auto it = sessions_.begin(); it != sessions_.end();) {
         if (it->second->isTimedOut(timeout)) {
-            LOG_INFO("SERVER", "Client timed out: " + it->first);
+            std::stringstream ss;
+            ss << it->first;
+            LOG_INFO("SERVER", "Client timed out: " + ss.str());
             // Notify others could happen here (CLIENT_LEFT)
             it = sessions_.erase(it);
         } else {
@@ -126,12 +183,8 @@ void UdpServer::checkTimeouts() {
 }
 
 std::shared_ptr<ClientSession> UdpServer::getSession(const udp::endpoint& endpoint) {
-    std::stringstream ss;
-    ss << endpoint;
-    std::string key = ss.str();
-
     std::lock_guard<std::mutex> lock(sessionsMutex_);
-    auto it = sessions_.find(key);
+    auto it = sessions_.find(endpoint);
     if (it != sessions_.end()) {
         return it->second;
     }
@@ -139,12 +192,8 @@ std::shared_ptr<ClientSession> UdpServer::getSession(const udp::endpoint& endpoi
 }
 
 bool UdpServer::removeSession(const udp::endpoint& endpoint) {
-    std::stringstream ss;
-    ss << endpoint;
-    std::string key = ss.str();
-
     std::lock_guard<std::mutex> lock(sessionsMutex_);
-    return sessions_.erase(key) > 0;
+    return sessions_.erase(endpoint) > 0;
 }
 
 std::vector<ClientSession> UdpServer::getActiveSessions() const {
@@ -0,0 +1,116 @@
+#include <rendering/AtlasPacker.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+
+            AtlasPacker::AtlasPacker(uint32_t width, uint32_t height, uint32_t padding)
+                : width_(width), height_(height), padding_(padding)
+            {
+                reset();
+            }
+
+            void AtlasPacker::reset()
+            {
+                usedArea_ = 0;
+                skyline_.clear();
+                skyline_.push_back(Segment{0, 0, width_});
+            }
+
+            bool AtlasPacker::fits(std::size_t index, uint32_t width, uint32_t height, uint32_t &y) const
+            {
+                const uint32_t x = skyline_[index].x;
+                if (width > width_ - x) {
+                    return false;
+                }
+
+                // The rectangle rests on the highest segment it spans
+                y = 0;
+                uint32_t remaining = width;
+                for (std::size_t i = index; remaining > 0; ++i) {
+                    y = std::max(y, skyline_[i].y);
+                    if (height > height_ - y) {
+                        return false;
+                    }
+                    remaining -= std::min(remaining, skyline_[i].width);
+                }
+                return true;
+            }
+
+            bool AtlasPacker::pack(uint32_t width, uint32_t height, IntRect &out)
+            {
+                if (width == 0 || height == 0) {
+                    return false;
+                }
+                const uint32_t paddedWidth = width + padding_;
+                const uint32_t paddedHeight = height + padding_;
+
+                // Lowest resulting top edge wins, then the narrowest segment
+                std::size_t best = skyline_.size();
+                uint32_t bestY = 0;
+                uint32_t bestTop = std::numeric_limits<uint32_t>::max();
+                uint32_t bestSegmentWidth = std::numeric_limits<uint32_t>::max();
+                for (std::size_t i = 0; i < skyline_.size(); ++i) {
+                    uint32_t y = 0;
+                    if (!fits(i, paddedWidth, paddedHeight, y)) {
+                        continue;
+                    }
+                    const uint32_t top = y + paddedHeight;
+                    if (top < bestTop || (top == bestTop && skyline_[i].width < bestSegmentWidth)) {
+                        best = i;
+                        bestY = y;
+                        bestTop = top;
+                        bestSegmentWidth = skyline_[i].width;
+                    }
+                }
+                if (best == skyline_.size()) {
+                    return false;
+                }
+
+                const uint32_t x = skyline_[best].x;
+                out = IntRect(static_cast<int>(x), static_cast<int>(bestY), static_cast<int>(width), static_cast<int>(height));
+                usedArea_ += static_cast<uint64_t>(width) * height;
+
+                // Raise the skyline under the new rectangle, trimming the segments it covers
+                skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(best), Segment{x, bestTop, paddedWidth});
+                const uint32_t right = x + paddedWidth;
+                std::size_t next = best + 1;
+                while (next < skyline_.size() && skyline_[next].x < right) {
+                    Segment &segment = skyline_[next];
+                    const uint32_t segmentRight = segment.x + segment.width;
+                    if (segmentRight <= right) {
+                        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(next));
+                        continue;
+                    }
+                    segment.width = segmentRight - right;
+                    segment.x = right;
+                    break;
+                }
+
+                // Merge neighbours left at the same height
+                for (std::size_t i = 0; i + 1 < skyline_.size();) {
+                    if (skyline_[i].y == skyline_[i + 1].y) {
+                        skyline_[i].width += skyline_[i + 1].width;
+                        skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+                    } else {
+                        ++i;
+                    }
+                }
+                return true;
+            }
+
+            float AtlasPacker::getOccupancy() const
+            {
+                const uint64_t area = static_cast<uint64_t>(width_) * height_;
+                return area == 0 ? 0.0f : static_cast<float>(usedArea_) / static_cast<float>(area);
+            }
+
+        }
+    }
+}
@@ -20,6 +20,18 @@ namespace eng
                     zoom_ = zoom;
             }
 
+            void Camera::setViewport(IntRect viewport)
+            {
+                viewport_ = viewport;
+            }
+
+            FloatRect Camera::getVisibleArea() const
+            {
+                const float width = viewport_.width / zoom_;
+                const float height = viewport_.height / zoom_;
+                return FloatRect(position_.x - width / 2.0f, position_.y - height / 2.0f, width, height);
+            }
+
             Vector2f Camera::worldToScreen(Vector2f worldPos) const
             {
                 Vector2f relative;
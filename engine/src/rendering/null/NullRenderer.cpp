@@ -0,0 +1,160 @@
+#include <rendering/null/NullRenderer.hpp>
+#include "core/Profiler.hpp"
+#include <algorithm>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace null
+            {
+
+                void NullRenderer::clear()
+                {
+                    commands_.clear();
+                    pending_.clear();
+                    drawCalls_ = 0;
+                }
+
+                void NullRenderer::draw(ISprite &sprite, const Transform &transform)
+                {
+                    flush();
+
+                    DrawCommand command;
+                    command.kind = DrawCommand::Kind::Sprite;
+                    command.texture = sprite.getTexture();
+                    command.transform = transform;
+                    if (const auto *nullSprite = dynamic_cast<const NullSprite *>(&sprite)) {
+                        command.textureRect = nullSprite->getTextureRect();
+                    }
+                    command.drawCall = drawCalls_;
+                    commands_.push_back(command);
+                    recordDrawCall();
+                }
+
+                void NullRenderer::drawText(IText &text)
+                {
+                    (void)text;
+                    flush();
+
+                    DrawCommand command;
+                    command.kind = DrawCommand::Kind::Text;
+                    command.drawCall = drawCalls_;
+                    commands_.push_back(command);
+                    recordDrawCall();
+                }
+
+                void NullRenderer::drawRect(const FloatRect &rect, uint32_t fillColor, uint32_t outlineColor, float outlineThickness)
+                {
+                    (void)outlineColor;
+                    (void)outlineThickness;
+                    flush();
+
+                    DrawCommand command;
+                    command.kind = DrawCommand::Kind::Rect;
+                    command.rect = rect;
+                    command.color = fillColor;
+                    command.drawCall = drawCalls_;
+                    commands_.push_back(command);
+                    recordDrawCall();
+                }
+
+                void NullRenderer::display()
+                {
+                    flush();
+                    ++frames_;
+                }
+
+                void NullRenderer::setCamera(const Camera &camera)
+                {
+                    flush();
+                    camera_ = camera;
+                }
+
+                void NullRenderer::submit(ISprite &sprite, const Transform &transform, int layer, const IntRect &textureRect)
+                {
+                    const ITexture *texture = sprite.getTexture();
+                    if (!texture) {
+                        return;
+                    }
+
+                    DrawCommand command;
+                    command.kind = DrawCommand::Kind::Sprite;
+                    command.texture = texture;
+                    command.layer = layer;
+                    command.transform = transform;
+                    if (textureRect.width != 0 || textureRect.height != 0) {
+                        command.textureRect = textureRect;
+                    } else if (const auto *nullSprite = dynamic_cast<const NullSprite *>(&sprite)) {
+                        command.textureRect = nullSprite->getTextureRect();
+                    }
+                    pending_.push_back(command);
+                }
+
+                void NullRenderer::flush()
+                {
+                    if (pending_.empty()) {
+                        return;
+                    }
+
+                    // Same grouping as SFMLRenderer: batches in order of first use, per layer
+                    struct Batch {
+                        int layer;
+                        const ITexture *texture;
+                    };
+                    std::vector<Batch> batches;
+                    std::vector<std::size_t> batchOf(pending_.size());
+                    for (std::size_t i = 0; i < pending_.size(); ++i) {
+                        std::size_t b = 0;
+                        while (b < batches.size() && (batches[b].layer != pending_[i].layer || batches[b].texture != pending_[i].texture)) {
+                            ++b;
+                        }
+                        if (b == batches.size()) {
+                            batches.push_back(Batch{pending_[i].layer, pending_[i].texture});
+                        }
+                        batchOf[i] = b;
+                    }
+
+                    order_.resize(pending_.size());
+                    for (std::size_t i = 0; i < order_.size(); ++i) {
+                        order_[i] = i;
+                    }
+                    std::stable_sort(order_.begin(), order_.end(), [&](std::size_t a, std::size_t b) {
+                        const Batch &batchA = batches[batchOf[a]];
+                        const Batch &batchB = batches[batchOf[b]];
+                        if (batchA.layer != batchB.layer) {
+                            return batchA.layer < batchB.layer;
+                        }
+                        return batchOf[a] < batchOf[b];
+                    });
+
+                    for (std::size_t i = 0; i < order_.size(); ++i) {
+                        if (i > 0 && batchOf[order_[i]] != batchOf[order_[i - 1]]) {
+                            recordDrawCall();
+                        }
+                        DrawCommand command = pending_[order_[i]];
+                        command.drawCall = drawCalls_;
+                        commands_.push_back(command);
+                    }
+                    recordDrawCall();
+                    pending_.clear();
+                }
+
+                std::size_t NullRenderer::getSpriteCount() const
+                {
+                    return static_cast<std::size_t>(std::count_if(commands_.begin(), commands_.end(),
+                        [](const DrawCommand &command) { return command.kind == DrawCommand::Kind::Sprite; }));
+                }
+
+                void NullRenderer::recordDrawCall()
+                {
+                    ++drawCalls_;
+                    rtype::core::Profiler::getInstance().addDrawCall();
+                }
+
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#include <rendering/null/NullTexture.hpp>
+#include <fstream>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace null
+            {
+
+                bool NullTexture::loadFromFile(const std::string &path)
+                {
+                    std::ifstream file(path, std::ios::binary);
+                    if (!file) {
+                        return false;
+                    }
+                    path_ = path;
+                    size_ = Vector2u();
+
+                    // PNG: 8-byte signature, then the IHDR chunk with big-endian width and height
+                    unsigned char header[24] = {};
+                    if (!file.read(reinterpret_cast<char *>(header), sizeof(header))) {
+                        return true;
+                    }
+                    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+                    for (int i = 0; i < 8; ++i) {
+                        if (header[i] != signature[i]) {
+                            return true;
+                        }
+                    }
+                    auto readBigEndian = [&header](int offset) {
+                        return (static_cast<uint32_t>(header[offset]) << 24) | (static_cast<uint32_t>(header[offset + 1]) << 16) |
+                               (static_cast<uint32_t>(header[offset + 2]) << 8) | static_cast<uint32_t>(header[offset + 3]);
+                    };
+                    size_ = Vector2u(readBigEndian(16), readBigEndian(20));
+                    return true;
+                }
+
+            }
+        }
+    }
+}
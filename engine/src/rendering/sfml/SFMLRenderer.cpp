@@ -1,5 +1,8 @@
 #include <rendering/sfml/SFMLRenderer.hpp>
 #include <SFML/Graphics/View.hpp>
+#include "core/Profiler.hpp"
+#include <algorithm>
+#include <cstdlib>
 
 namespace eng
 {
@@ -14,6 +17,11 @@ namespace eng
 
                 void SFMLRenderer::clear()
                 {
+                    // Sprites queued for the previous frame are dropped
+                    for (std::size_t i = 0; i < activeBatches_; ++i) {
+                        batches_[i].vertices.clear();
+                    }
+                    activeBatches_ = 0;
                     window_->clear(sf::Color::Black);
                 }
 
@@ -28,15 +36,102 @@ namespace eng
                         nativeSprite.setRotation(transform.rotation);
                         nativeSprite.setScale(transform.scale.x, transform.scale.y);
 
-                        window_->draw(nativeSprite);
+                        // Keep queued sprites underneath
+                        flush();
+                        drawNative(nativeSprite);
+                    }
+                }
+
+                void SFMLRenderer::submit(ISprite &sprite, const Transform &transform, int layer, const IntRect &textureRect)
+                {
+                    SFMLSprite *sfmlSprite = dynamic_cast<SFMLSprite *>(&sprite);
+                    if (!sfmlSprite) {
+                        return;
+                    }
+                    sf::Sprite &nativeSprite = sfmlSprite->getNativeSprite();
+                    const sf::Texture *texture = nativeSprite.getTexture();
+                    if (!texture) {
+                        return;
+                    }
+
+                    nativeSprite.setPosition(transform.position.x, transform.position.y);
+                    nativeSprite.setRotation(transform.rotation);
+                    nativeSprite.setScale(transform.scale.x, transform.scale.y);
+
+                    // Batches of one layer are few: a backward scan finds the match
+                    Batch *batch = nullptr;
+                    for (std::size_t i = activeBatches_; i > 0; --i) {
+                        Batch &candidate = batches_[i - 1];
+                        if (candidate.layer == layer && candidate.texture == texture) {
+                            batch = &candidate;
+                            break;
+                        }
+                    }
+                    if (!batch) {
+                        if (activeBatches_ == batches_.size()) {
+                            batches_.emplace_back();
+                        }
+                        batch = &batches_[activeBatches_++];
+                        batch->layer = layer;
+                        batch->texture = texture;
+                        batch->vertices.clear();
                     }
+
+                    // Same geometry as sf::Sprite: a negative rect size flips the texture
+                    const bool ownRect = textureRect.width == 0 && textureRect.height == 0;
+                    const sf::IntRect rect = ownRect ? nativeSprite.getTextureRect() : sfmlSprite->toNativeRect(textureRect);
+                    const float width = static_cast<float>(std::abs(rect.width));
+                    const float height = static_cast<float>(std::abs(rect.height));
+                    const float left = static_cast<float>(rect.left);
+                    const float top = static_cast<float>(rect.top);
+                    const float right = left + static_cast<float>(rect.width);
+                    const float bottom = top + static_cast<float>(rect.height);
+
+                    const sf::Transform &matrix = nativeSprite.getTransform();
+                    const sf::Color color = nativeSprite.getColor();
+                    const sf::Vertex topLeft(matrix.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+                    const sf::Vertex topRight(matrix.transformPoint(width, 0.f), color, sf::Vector2f(right, top));
+                    const sf::Vertex bottomLeft(matrix.transformPoint(0.f, height), color, sf::Vector2f(left, bottom));
+                    const sf::Vertex bottomRight(matrix.transformPoint(width, height), color, sf::Vector2f(right, bottom));
+
+                    sf::VertexArray &vertices = batch->vertices;
+                    vertices.append(topLeft);
+                    vertices.append(bottomLeft);
+                    vertices.append(topRight);
+                    vertices.append(topRight);
+                    vertices.append(bottomLeft);
+                    vertices.append(bottomRight);
+                }
+
+                void SFMLRenderer::flush()
+                {
+                    if (activeBatches_ == 0) {
+                        return;
+                    }
+
+                    // Lower layers first; batches of one layer keep their submission order
+                    drawOrder_.clear();
+                    for (std::size_t i = 0; i < activeBatches_; ++i) {
+                        drawOrder_.push_back(i);
+                    }
+                    std::stable_sort(drawOrder_.begin(), drawOrder_.end(), [this](std::size_t a, std::size_t b) {
+                        return batches_[a].layer < batches_[b].layer;
+                    });
+
+                    for (std::size_t index : drawOrder_) {
+                        Batch &batch = batches_[index];
+                        drawNative(batch.vertices, sf::RenderStates(batch.texture));
+                        batch.vertices.clear();
+                    }
+                    activeBatches_ = 0;
                 }
 
                 void SFMLRenderer::drawText(IText &text)
                 {
                     SFMLText *sfmlText = dynamic_cast<SFMLText *>(&text);
                     if (sfmlText) {
-                        window_->draw(sfmlText->getNativeText());
+                        flush();
+                        drawNative(sfmlText->getNativeText());
                     }
                 }
 
@@ -51,12 +146,14 @@ namespace eng
                         shape.setOutlineColor(toSFMLColor(outlineColor));
                         shape.setOutlineThickness(outlineThickness);
                     }
-                    
-                    window_->draw(shape);
+
+                    flush();
+                    drawNative(shape);
                 }
 
                 void SFMLRenderer::display()
                 {
+                    flush();
                     window_->display();
                 }
 
@@ -71,9 +168,17 @@ namespace eng
                     view.setSize(viewport.width / zoom, viewport.height / zoom);
                     view.setViewport(sf::FloatRect(0.f, 0.f, 1.f, 1.f));
 
+                    // Queued sprites belong to the previous view
+                    flush();
                     window_->setView(view);
                 }
 
+                void SFMLRenderer::drawNative(const sf::Drawable &drawable, const sf::RenderStates &states)
+                {
+                    window_->draw(drawable, states);
+                    rtype::core::Profiler::getInstance().addDrawCall();
+                }
+
                 sf::Color SFMLRenderer::toSFMLColor(uint32_t rgba)
                 {
                     // Format: 0xRRGGBBAA
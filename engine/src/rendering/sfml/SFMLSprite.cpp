@@ -15,6 +15,7 @@ namespace eng
                         return;
 
                     currentTexture_ = dynamic_cast<SFMLTexture *>(texture);
+                    atlasOffset_ = Vector2i();
                     if (currentTexture_)
                         sprite_.setTexture(currentTexture_->getNativeTexture());
                 }
@@ -26,7 +27,24 @@ namespace eng
 
                 void SFMLSprite::setTextureRect(IntRect rect)
                 {
-                    sprite_.setTextureRect(sf::IntRect(rect.left, rect.top, rect.width, rect.height));
+                    sprite_.setTextureRect(toNativeRect(rect));
+                }
+
+                IntRect SFMLSprite::getTextureRect() const
+                {
+                    const sf::IntRect rect = sprite_.getTextureRect();
+                    return IntRect(rect.left, rect.top, rect.width, rect.height);
+                }
+
+                sf::IntRect SFMLSprite::toNativeRect(IntRect rect) const
+                {
+                    return sf::IntRect(rect.left + atlasOffset_.x, rect.top + atlasOffset_.y, rect.width, rect.height);
+                }
+
+                void SFMLSprite::setAtlasRegion(IntRect region)
+                {
+                    atlasOffset_ = Vector2i(region.left, region.top);
+                    sprite_.setTextureRect(sf::IntRect(region.left, region.top, region.width, region.height));
                 }
 
             }
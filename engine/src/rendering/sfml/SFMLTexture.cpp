@@ -25,6 +25,18 @@ namespace eng
                     return texture_.loadFromImage(image, area);
                 }
 
+                bool SFMLTexture::create(unsigned int width, unsigned int height)
+                {
+                    sf::Image blank;
+                    blank.create(width, height, sf::Color::Transparent);
+                    return texture_.loadFromImage(blank);
+                }
+
+                void SFMLTexture::update(const sf::Image &image, unsigned int x, unsigned int y)
+                {
+                    texture_.update(image, x, y);
+                }
+
             }
         }
     }
@@ -0,0 +1,65 @@
+#include <rendering/sfml/SFMLTextureAtlas.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+
+namespace eng
+{
+    namespace engine
+    {
+        namespace rendering
+        {
+            namespace sfml
+            {
+
+                SFMLTextureAtlas::SFMLTextureAtlas(unsigned int pageSize, unsigned int maxImageSize, unsigned int padding)
+                    : pageSize_(std::min(pageSize, sf::Texture::getMaximumSize()))
+                    , maxImageSize_(std::min(maxImageSize, pageSize_ - padding))
+                    , padding_(padding)
+                {
+                }
+
+                bool SFMLTextureAtlas::acquire(const std::string &path, Region &region)
+                {
+                    auto it = regions_.find(path);
+                    if (it != regions_.end()) {
+                        region = it->second;
+                        return true;
+                    }
+
+                    sf::Image image;
+                    if (!image.loadFromFile(path)) {
+                        return false;
+                    }
+                    const sf::Vector2u size = image.getSize();
+                    if (size.x == 0 || size.y == 0 || size.x > maxImageSize_ || size.y > maxImageSize_) {
+                        return false;
+                    }
+
+                    IntRect rect;
+                    Page *target = nullptr;
+                    for (Page &page : pages_) {
+                        if (page.packer.pack(size.x, size.y, rect)) {
+                            target = &page;
+                            break;
+                        }
+                    }
+                    if (!target) {
+                        Page page{std::make_unique<SFMLTexture>(), AtlasPacker(pageSize_, pageSize_, padding_)};
+                        if (!page.texture->create(pageSize_, pageSize_) || !page.packer.pack(size.x, size.y, rect)) {
+                            return false;
+                        }
+                        pages_.push_back(std::move(page));
+                        target = &pages_.back();
+                    }
+
+                    target->texture->update(image, static_cast<unsigned int>(rect.left), static_cast<unsigned int>(rect.top));
+                    region.texture = target->texture.get();
+                    region.rect = rect;
+                    regions_.emplace(path, region);
+                    return true;
+                }
+
+            }
+        }
+    }
+}
@@ -254,6 +254,8 @@ void CoreBindings::RegisterProfiler(sol::state& lua) {
         stats["memory"] = profiler.getMemoryUsageMB();
         stats["entities"] = profiler.getEntityCount();
         stats["drawCalls"] = profiler.getDrawCalls();
+        stats["spritesDrawn"] = profiler.getSpritesDrawn();
+        stats["spritesCulled"] = profiler.getSpritesCulled();
         stats["bytesSent"] = netStats.bytesSent;
         stats["bytesReceived"] = netStats.bytesReceived;
         
@@ -13,7 +13,7 @@ void ScriptSystem::Update(float dt) {
     if (!mUpdateFunction.valid()) return;
 
     // Call Lua update function with entities and dt
-    auto result = mUpdateFunction(mEntities, dt, mCoordinator);
+    auto result = mUpdateFunction(mEntities.Dense(), dt, mCoordinator);
     
     if (!result.valid()) {
         sol::error err = result;
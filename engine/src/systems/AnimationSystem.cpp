@@ -17,21 +17,65 @@ void AnimationSystem::Shutdown()
 {
 }
 
+void AnimationSystem::Step(State& state, float dt)
+{
+    Phase& phase = state.phase;
+    state.frameChanged = false;
+    state.hide = false;
+
+    // If animation finished and not looping, hide the sprite immediately
+    if (phase.finished && !phase.loop) {
+        state.hide = true;
+        return;
+    }
+
+    phase.currentTime += dt;
+    if (phase.currentTime < phase.frameTime) {
+        return;
+    }
+
+    phase.currentTime = 0.0f;
+    phase.currentFrame++;
+    if (phase.currentFrame >= phase.frameCount) {
+        if (phase.loop) {
+            phase.currentFrame = 0;
+        } else {
+            // Animation finished - hide sprite, keep the last frame
+            phase.currentFrame = phase.frameCount - 1;
+            phase.finished = true;
+            state.hide = true;
+            return;
+        }
+    }
+    state.frameChanged = true;
+}
+
 void AnimationSystem::Update(float dt)
 {
     if (!coordinator_) return;
 
-    // Update basic frame-based animations
-    for (auto entity : mEntities) {
-        if (!coordinator_->HasComponent<Animation>(entity) || 
-            !coordinator_->HasComponent<Sprite>(entity))
-            continue;
+    // Gather: one packed state per animated sprite, straight from the component pools
+    states_.clear();
+    coordinator_->View<Animation, Sprite>().Each([this](ECS::Entity, Animation& anim, Sprite& sprite) {
+        const Phase phase{anim.currentTime, anim.frameTime, anim.currentFrame, anim.frameCount, anim.loop, anim.finished};
+        states_.push_back(State{phase, false, false, &anim, &sprite});
+    });
 
-        auto& anim = coordinator_->GetComponent<Animation>(entity);
-        auto& sprite = coordinator_->GetComponent<Sprite>(entity);
+    // Step: over the packed array only
+    for (State& state : states_) {
+        Step(state, dt);
+    }
 
-        // If animation finished and not looping, hide the sprite immediately
-        if (anim.finished && !anim.loop) {
+    // Scatter: write the components back. The frame rect only goes into the Sprite
+    // component; the renderer applies it when batching
+    for (const State& state : states_) {
+        Animation& anim = *state.animation;
+        Sprite& sprite = *state.sprite;
+        anim.currentTime = state.phase.currentTime;
+        anim.currentFrame = state.phase.currentFrame;
+        anim.finished = state.phase.finished;
+
+        if (state.hide) {
             if (sprite.sprite) {
                 // Hide sprite by setting scale to 0
                 sprite.scaleX = 0.0f;
@@ -39,45 +83,20 @@ void AnimationSystem::Update(float dt)
             }
             continue;
         }
+        if (!state.frameChanged) {
+            continue;
+        }
 
-        anim.currentTime += dt;
-
-        if (anim.currentTime >= anim.frameTime) {
-            anim.currentTime = 0.0f;
-            anim.currentFrame++;
-
-            if (anim.currentFrame >= anim.frameCount) {
-                if (anim.loop) {
-                    anim.currentFrame = 0;
-                } else {
-                    // Animation finished - hide sprite IMMEDIATELY
-                    anim.currentFrame = anim.frameCount - 1;
-                    anim.finished = true;
-                    if (sprite.sprite) {
-                        sprite.scaleX = 0.0f;
-                        sprite.scaleY = 0.0f;
-                    }
-                    continue;  // Don't update texture rect, sprite is hidden
-                }
-            }
-
-            // Update sprite texture rect
-            if (anim.vertical) {
-                // Vertical spritesheet: frames stacked top-to-bottom
-                sprite.textureRect.left = anim.startX;
-                sprite.textureRect.top = anim.startY + (anim.currentFrame * (anim.frameHeight + anim.spacing));
-            } else {
-                // Horizontal spritesheet: frames left-to-right (default)
-                sprite.textureRect.left = anim.startX + (anim.currentFrame * (anim.frameWidth + anim.spacing));
-                sprite.textureRect.top = anim.startY;
-            }
-            sprite.textureRect.width = anim.frameWidth;
-            sprite.textureRect.height = anim.frameHeight;
-
-            // Apply to native sprite if exists
-            if (sprite.sprite) {
-                sprite.sprite->setTextureRect(sprite.textureRect);
-            }
+        if (anim.vertical) {
+            // Vertical spritesheet: frames stacked top-to-bottom
+            sprite.textureRect.left = anim.startX;
+            sprite.textureRect.top = anim.startY + (anim.currentFrame * (anim.frameHeight + anim.spacing));
+        } else {
+            // Horizontal spritesheet: frames left-to-right (default)
+            sprite.textureRect.left = anim.startX + (anim.currentFrame * (anim.frameWidth + anim.spacing));
+            sprite.textureRect.top = anim.startY;
         }
+        sprite.textureRect.width = anim.frameWidth;
+        sprite.textureRect.height = anim.frameHeight;
     }
 }
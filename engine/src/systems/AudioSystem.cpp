@@ -19,11 +19,7 @@ void AudioSystem::Update(float /*deltaTime*/) {
     if (!m_coordinator) return;
 
     // Process all entities with AudioSource component
-    for (auto entity : mEntities) {
-        if (!m_coordinator->HasComponent<AudioSource>(entity)) continue;
-        
-        auto& audioSrc = m_coordinator->GetComponent<AudioSource>(entity);
-        
+    m_coordinator->View<AudioSource>().Each([this](::ECS::Entity entity, AudioSource& audioSrc) {
         // Check if sound should start playing
         if (audioSrc.playOnStart && !audioSrc.isPlaying) {
             // Get or load the sound buffer
@@ -31,7 +27,7 @@ void AudioSystem::Update(float /*deltaTime*/) {
             if (!buffer) {
                 LOG_ERROR("AUDIOSYSTEM", "Failed to load sound: " + audioSrc.soundPath);
                 audioSrc.playOnStart = false; // Don't try again
-                continue;
+                return;
             }
 
             // Create and play the sound
@@ -62,12 +58,13 @@ void AudioSystem::Update(float /*deltaTime*/) {
                 if (m_coordinator->HasComponent<SoundEffect>(entity)) {
                     auto& sfx = m_coordinator->GetComponent<SoundEffect>(entity);
                     if (sfx.autoDestroy) {
-                        m_coordinator->DestroyEntity(entity);
+                        m_commands.DestroyEntity(entity);
                     }
                 }
             }
         }
-    }
+    });
+    m_commands.Flush();
 
     // Cleanup finished one-shot sounds
     CleanupFinishedSounds();
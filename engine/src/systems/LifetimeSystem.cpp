@@ -4,7 +4,8 @@
 #include <vector>
 
 LifetimeSystem::LifetimeSystem(ECS::Coordinator* coordinator)
-    : m_Coordinator(coordinator) {
+    : m_Coordinator(coordinator)
+    , m_Commands(coordinator) {
 }
 
 void LifetimeSystem::Init() {
@@ -12,36 +13,33 @@ void LifetimeSystem::Init() {
 }
 
 void LifetimeSystem::Update(float dt) {
-    std::vector<ECS::Entity> toDestroy;
-    
-    for (auto entity : mEntities) {
-        bool shouldDestroy = false;
-        
-        // Check generic Lifetime component (for explosions, effects, etc.)
-        if (m_Coordinator->HasComponent<Lifetime>(entity)) {
-            auto& lifetime = m_Coordinator->GetComponent<Lifetime>(entity);
+    // Age every generic Lifetime component (explosions, effects, etc.) in parallel
+    // chunks; expired entities come back in a deterministic order
+    std::vector<ECS::Entity> expired = ECS::ParallelCollect(m_ThreadPool, m_Coordinator->View<Lifetime>(),
+        [dt](ECS::Entity, Lifetime& lifetime) {
             lifetime.timeAlive += dt;
-            
-            if (lifetime.timeAlive >= lifetime.maxLifetime && lifetime.destroyOnExpire) {
-                shouldDestroy = true;
-            }
-        }
-        
-        // NOTE: Game-specific lifetime components (Projectile, PowerUp, etc.) removed
-        // The generic Lifetime component handles all entity lifetime management
-        // Games can extend this system or create their own for specific behavior
-        
-        if (shouldDestroy) {
-            toDestroy.push_back(entity);
-        }
+            return lifetime.timeAlive >= lifetime.maxLifetime && lifetime.destroyOnExpire;
+        }, m_ParallelOptions);
+
+    // NOTE: Game-specific lifetime components (Projectile, PowerUp, etc.) removed
+    // The generic Lifetime component handles all entity lifetime management
+    // Games can extend this system or create their own for specific behavior
+
+    for (auto entity : expired) {
+        m_Commands.DestroyEntity(entity);
     }
     
-    // Destroy expired entities
-    for (auto entity : toDestroy) {
-        m_Coordinator->DestroyEntity(entity);
+    // A scheduler may run other systems alongside: it destroys at its sync point
+    if (!IsScheduled()) {
+        ApplyDeferred();
     }
 }
 
+void LifetimeSystem::ApplyDeferred() {
+    // Destroy expired entities
+    m_Commands.Flush();
+}
+
 void LifetimeSystem::Shutdown() {
     LOG_INFO("LIFETIMESYSTEM", "Shutdown");
 }
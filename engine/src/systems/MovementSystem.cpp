@@ -13,22 +13,14 @@ void MovementSystem::Init() {
 }
 
 void MovementSystem::Update(float dt) {
-    static int frameCount = 0;
-    
-    for (auto entity : mEntities) {
-        // Check if entity has Position and Velocity components
-        if (!m_Coordinator->HasComponent<Position>(entity) || 
-            !m_Coordinator->HasComponent<Velocity>(entity)) {
-            continue;
-        }
-        
-        auto& position = m_Coordinator->GetComponent<Position>(entity);
-        auto& velocity = m_Coordinator->GetComponent<Velocity>(entity);
-        
-        // Apply velocity to position
-        position.x += velocity.dx * dt;
-        position.y += velocity.dy * dt;
-    }
+    // Entities owning both Position and Velocity, no per-entity type lookup;
+    // each entity only touches its own components, so chunks run in parallel
+    ECS::ParallelForEach(m_ThreadPool, m_Coordinator->View<Position, Velocity>(),
+        [dt](ECS::Entity, Position& position, Velocity& velocity) {
+            // Apply velocity to position
+            position.x += velocity.dx * dt;
+            position.y += velocity.dy * dt;
+        }, m_ParallelOptions);
 }
 
 void MovementSystem::Shutdown() {
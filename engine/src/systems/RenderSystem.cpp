@@ -5,9 +5,11 @@
 #include <ecs/Coordinator.hpp>
 #include <rendering/Types.hpp>
 #include <rendering/IRenderer.hpp>
-#include "core/Logger.hpp"
+#include <rendering/Camera.hpp>
+#include "core/Profiler.hpp"
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 
 RenderSystem::RenderSystem()
     : renderer_(nullptr)
@@ -15,6 +17,11 @@ RenderSystem::RenderSystem()
 {
 }
 
+RenderSystem::~RenderSystem()
+{
+    rtype::core::Profiler::getInstance().unregisterEntityCensus(this);
+}
+
 void RenderSystem::Init()
 {
     // nothing to init by default
@@ -24,6 +31,106 @@ void RenderSystem::Shutdown()
 {
 }
 
+void RenderSystem::SetCoordinator(ECS::Coordinator *coordinator)
+{
+    coordinator_ = coordinator;
+
+    auto &profiler = rtype::core::Profiler::getInstance();
+    if (!coordinator_) {
+        profiler.unregisterEntityCensus(this);
+        return;
+    }
+    // Renderable entities per tag, counted only when a profiler report is generated
+    profiler.registerEntityCensus(this, [this](std::map<std::string, uint64_t> &counts) {
+        if (!coordinator_) {
+            return;
+        }
+        for (auto entity : mEntities) {
+            if (coordinator_->HasComponent<Tag>(entity)) {
+                ++counts[coordinator_->GetComponent<Tag>(entity).name];
+            }
+        }
+    });
+}
+
+RenderSystem::Slot &RenderSystem::SlotOf(ECS::Entity entity)
+{
+    if (entity >= slots_.size()) {
+        slots_.resize(static_cast<std::size_t>(entity) + 1);
+    }
+    return slots_[entity];
+}
+
+const eng::engine::rendering::ITexture *RenderSystem::TextureOf(const Sprite &sprite)
+{
+    return sprite.sprite ? sprite.sprite->getTexture() : nullptr;
+}
+
+uint32_t RenderSystem::BucketFor(int layer, const eng::engine::rendering::ITexture *texture)
+{
+    const uint32_t textureId = textureIds_.emplace(texture, static_cast<uint32_t>(textureIds_.size())).first->second;
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(layer)) << 32) | textureId;
+
+    auto found = bucketByKey_.find(key);
+    if (found != bucketByKey_.end()) {
+        return found->second;
+    }
+
+    // First time this pair is drawn: slot the new bucket into the draw order
+    const uint32_t index = static_cast<uint32_t>(buckets_.size());
+    Bucket bucket;
+    bucket.layer = layer;
+    bucket.texture = texture;
+    bucket.textureId = textureId;
+    buckets_.push_back(std::move(bucket));
+    bucketByKey_.emplace(key, index);
+    auto position = std::lower_bound(bucketOrder_.begin(), bucketOrder_.end(), index, [this](uint32_t a, uint32_t b) {
+        const Bucket &lhs = buckets_[a];
+        const Bucket &rhs = buckets_[b];
+        return lhs.layer != rhs.layer ? lhs.layer < rhs.layer : lhs.textureId < rhs.textureId;
+    });
+    bucketOrder_.insert(position, index);
+    return index;
+}
+
+void RenderSystem::Place(const QueueItem &item)
+{
+    const uint32_t bucket = BucketFor(item.sprite->layer, TextureOf(*item.sprite));
+    auto &items = buckets_[bucket].items;
+    SlotOf(item.entity) = Slot{bucket, static_cast<uint32_t>(items.size())};
+    items.push_back(item);
+}
+
+void RenderSystem::Unplace(ECS::Entity entity)
+{
+    Slot &slot = SlotOf(entity);
+    if (slot.bucket == PENDING) {
+        const ECS::Entity moved = pending_.back();
+        pending_[slot.index] = moved;
+        SlotOf(moved).index = slot.index;
+        pending_.pop_back();
+    } else if (slot.bucket != NO_BUCKET) {
+        auto &items = buckets_[slot.bucket].items;
+        const QueueItem moved = items.back();
+        items[slot.index] = moved;
+        SlotOf(moved.entity).index = slot.index;
+        items.pop_back();
+    }
+    slot = Slot{};
+}
+
+void RenderSystem::OnEntityAdded(ECS::Entity entity)
+{
+    // Placed at the next Update, once its components are readable
+    SlotOf(entity) = Slot{PENDING, static_cast<uint32_t>(pending_.size())};
+    pending_.push_back(entity);
+}
+
+void RenderSystem::OnEntityRemoved(ECS::Entity entity)
+{
+    Unplace(entity);
+}
+
 void RenderSystem::Update(float /*dt*/)
 {
     if (!renderer_ || !coordinator_) {
@@ -31,76 +138,97 @@ void RenderSystem::Update(float /*dt*/)
         return;
     }
 
-    // Collect all renderable entities and sort by layer
-    std::vector<ECS::Entity> renderableEntities;
-    for (auto entity : mEntities) {
-        if (coordinator_->HasComponent<Position>(entity) && 
-            coordinator_->HasComponent<Sprite>(entity)) {
-            renderableEntities.push_back(entity);
+    // Entities that joined since the last frame go straight into their bucket
+    for (std::size_t i = 0; i < pending_.size();) {
+        const ECS::Entity entity = pending_[i];
+        if (!coordinator_->HasComponent<Position>(entity) || !coordinator_->HasComponent<Sprite>(entity)) {
+            ++i;
+            continue;
         }
+        QueueItem item;
+        item.entity = entity;
+        item.sprite = &coordinator_->GetComponent<Sprite>(entity);
+        Unplace(entity);
+        Place(item);
     }
 
-    // Debug: Log enemy sprites being rendered
-    static int frameCounter = 0;
-    if (frameCounter++ % 60 == 0) {  // Every 60 frames
-        int enemyCount = 0;
-        int bulletCount = 0;
-        int playerBulletCount = 0;
-        int enemyBulletCount = 0;
-        for (auto entity : renderableEntities) {
-            if (coordinator_->HasComponent<Tag>(entity)) {
-                auto& tag = coordinator_->GetComponent<Tag>(entity);
-                if (tag.name == "Enemy") {
-                    enemyCount++;
-                } else if (tag.name == "PlayerBullet") {
-                    playerBulletCount++;
-                } else if (tag.name == "EnemyBullet") {
-                    enemyBulletCount++;
-                }
+    // Fetch the components once; an entity whose layer or texture changed moves bucket
+    moved_.clear();
+    for (uint32_t bucketIndex : bucketOrder_) {
+        Bucket &bucket = buckets_[bucketIndex];
+        for (auto &item : bucket.items) {
+            item.position = &coordinator_->GetComponent<Position>(item.entity);
+            item.sprite = &coordinator_->GetComponent<Sprite>(item.entity);
+            if (item.sprite->layer != bucket.layer || TextureOf(*item.sprite) != bucket.texture) {
+                moved_.push_back(item);
             }
         }
-        LOG_INFO("RENDERSYSTEM", "Rendering " + std::to_string(renderableEntities.size())
-                  + " entities (" + std::to_string(enemyCount) + " enemies, "
-                  + std::to_string(playerBulletCount) + " player bullets, "
-                  + std::to_string(enemyBulletCount) + " enemy bullets)");
+    }
+    for (const auto &item : moved_) {
+        Unplace(item.entity);
+        Place(item);
     }
 
-    // Sort by layer (lower layer = drawn first = background)
-    std::sort(renderableEntities.begin(), renderableEntities.end(), 
-        [this](ECS::Entity a, ECS::Entity b) {
-            auto& spriteA = coordinator_->GetComponent<Sprite>(a);
-            auto& spriteB = coordinator_->GetComponent<Sprite>(b);
-            return spriteA.layer < spriteB.layer;
-        });
+    eng::engine::rendering::FloatRect visible;
+    if (camera_) {
+        visible = camera_->getVisibleArea();
+    }
+    uint64_t drawn = 0;
+    uint64_t culled = 0;
 
-    // Draw all entities in order
-    for (auto entity : renderableEntities) {
-        auto &pos = coordinator_->GetComponent<Position>(entity);
-        auto &spr = coordinator_->GetComponent<Sprite>(entity);
+    // Submit bucket by bucket; the renderer batches them by layer and texture
+    for (uint32_t bucketIndex : bucketOrder_) {
+        for (const auto &item : buckets_[bucketIndex].items) {
+            auto &pos = *item.position;
+            auto &spr = *item.sprite;
 
-        // Debug logs removed for performance
+            if (!spr.sprite)
+                continue; // nothing to draw
 
-        if (!spr.sprite)
-            continue; // nothing to draw
+            // Skip sprites with zero scale (hidden/finished animations)
+            if (spr.scaleX <= 0.0f || spr.scaleY <= 0.0f)
+                continue;
 
-        // Skip sprites with zero scale (hidden/finished animations)
-        if (spr.scaleX <= 0.0f || spr.scaleY <= 0.0f)
-            continue;
+            // Off-screen: sprite size is the texture rect (else the sprite's own rect, e.g. its
+            // atlas region, else the whole texture) times the scale
+            if (camera_) {
+                float width = static_cast<float>(std::abs(spr.textureRect.width));
+                float height = static_cast<float>(std::abs(spr.textureRect.height));
+                if (width == 0.0f || height == 0.0f) {
+                    const eng::engine::rendering::IntRect rect = spr.sprite->getTextureRect();
+                    width = static_cast<float>(std::abs(rect.width));
+                    height = static_cast<float>(std::abs(rect.height));
+                }
+                if (width == 0.0f || height == 0.0f) {
+                    const eng::engine::rendering::ITexture *texture = spr.sprite->getTexture();
+                    width = texture ? static_cast<float>(texture->getSize().x) : 0.0f;
+                    height = texture ? static_cast<float>(texture->getSize().y) : 0.0f;
+                }
+                // Unknown size: always drawn
+                if (width > 0.0f && height > 0.0f) {
+                    width *= spr.scaleX;
+                    height *= spr.scaleY;
+                    if (pos.x >= visible.left + visible.width || pos.x + width <= visible.left ||
+                        pos.y >= visible.top + visible.height || pos.y + height <= visible.top) {
+                        ++culled;
+                        continue;
+                    }
+                }
+            }
 
-        // Build transform from Position
-        eng::engine::rendering::Transform t;
-        t.position.x = pos.x;
-        t.position.y = pos.y;
-        t.rotation = 0.0f;
-        t.scale.x = spr.scaleX;  // Use scale from Sprite component
-        t.scale.y = spr.scaleY;  // Use scale from Sprite component
-
-        // Apply texture rect if needed on the sprite instance
-        if (spr.textureRect.width != 0 || spr.textureRect.height != 0) {
-            spr.sprite->setTextureRect(spr.textureRect);
-        }
+            // Build transform from Position
+            eng::engine::rendering::Transform t;
+            t.position.x = pos.x;
+            t.position.y = pos.y;
+            t.rotation = 0.0f;
+            t.scale.x = spr.scaleX;  // Use scale from Sprite component
+            t.scale.y = spr.scaleY;  // Use scale from Sprite component
 
-        // Let the renderer draw the sprite with transform
-        renderer_->draw(*spr.sprite, t);
+            // The texture rect (set by animations) is applied by the renderer when batching
+            renderer_->submit(*spr.sprite, t, spr.layer, spr.textureRect);
+            ++drawn;
+        }
     }
+    renderer_->flush();
+    rtype::core::Profiler::getInstance().setSpriteCounts(drawn, culled);
 }
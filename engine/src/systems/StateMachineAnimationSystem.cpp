@@ -13,45 +13,25 @@ void StateMachineAnimationSystem::Init() {
 void StateMachineAnimationSystem::Update(float dt) {
     if (!m_Coordinator) return;
 
-    // Update state machine animations
-    for (auto entity : mEntities) {
-        if (!m_Coordinator->HasComponent<StateMachineAnimation>(entity) || 
-            !m_Coordinator->HasComponent<Sprite>(entity))
-            continue;
-
-        auto& anim = m_Coordinator->GetComponent<StateMachineAnimation>(entity);
-        auto& sprite = m_Coordinator->GetComponent<Sprite>(entity);
-
-        // Update transition timer
-        anim.transitionTime += dt;
-
-        // Perform column transition
-        if (anim.currentColumn != anim.targetColumn && 
-            anim.transitionTime >= anim.transitionSpeed) {
-            
-            anim.transitionTime = 0.0f;
-            
-            if (anim.currentColumn < anim.targetColumn) {
-                anim.currentColumn++;
-            } else if (anim.currentColumn > anim.targetColumn) {
-                anim.currentColumn--;
+    // Update state machine animations, walking the component pools directly
+    m_Coordinator->View<StateMachineAnimation, Sprite>().Each(
+        [dt](ECS::Entity, StateMachineAnimation& anim, Sprite& sprite) {
+            // Update transition timer
+            anim.transitionTime += dt;
+
+            // Perform column transition
+            if (anim.currentColumn == anim.targetColumn || anim.transitionTime < anim.transitionSpeed) {
+                return;
             }
-
-            // Update sprite texture rect
-            eng::engine::rendering::IntRect rect;
-            rect.left = anim.spriteWidth * anim.currentColumn;
-            rect.top = anim.spriteHeight * anim.currentRow;
-            rect.width = anim.spriteWidth;
-            rect.height = anim.spriteHeight;
-            
-            sprite.textureRect = rect;
-
-            // Apply to native sprite if exists
-            if (sprite.sprite) {
-                sprite.sprite->setTextureRect(rect);
-            }
-        }
-    }
+            anim.transitionTime = 0.0f;
+            anim.currentColumn += (anim.currentColumn < anim.targetColumn) ? 1 : -1;
+
+            // Only the component changes; the renderer applies the rect when batching
+            sprite.textureRect.left = anim.spriteWidth * anim.currentColumn;
+            sprite.textureRect.top = anim.spriteHeight * anim.currentRow;
+            sprite.textureRect.width = anim.spriteWidth;
+            sprite.textureRect.height = anim.spriteHeight;
+        });
 }
 
 void StateMachineAnimationSystem::Shutdown() {
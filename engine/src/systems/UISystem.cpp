@@ -617,9 +617,8 @@ void UISystem::UpdateNavigationOrder()
         }
     }
 
-    // Sort by tab index
-    std::sort(sortedEntities.begin(), sortedEntities.end(),
-              [](const auto& a, const auto& b) { return a.first < b.first; });
+    // Sort by tab index, ties in entity order
+    std::sort(sortedEntities.begin(), sortedEntities.end());
 
     for (const auto& [idx, entity] : sortedEntities) {
         m_navigableEntities.push_back(entity);
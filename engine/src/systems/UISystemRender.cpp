@@ -100,9 +100,8 @@ void UISystem::RenderElements(float dt)
         sortedEntities.push_back({element.layer, entity});
     }
 
-    // Sort by layer (lower first)
-    std::sort(sortedEntities.begin(), sortedEntities.end(),
-              [](const auto& a, const auto& b) { return a.first < b.first; });
+    // Sort by layer (lower first), ties in entity order
+    std::sort(sortedEntities.begin(), sortedEntities.end());
 
     // First pass: render all elements except open dropdowns
     std::vector<ECS::Entity> openDropdowns;
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <ecs/Coordinator.hpp>
+#include <ecs/ThreadPool.hpp>
 #include <rendering/sfml/SFMLWindow.hpp>
 #include <scripting/LuaState.hpp>
 #include "GameConfig.hpp"
@@ -47,6 +48,7 @@ public:
 
     // Getters for subsystems
     ECS::Coordinator* getCoordinator() { return coordinator_.get(); }
+    ECS::ThreadPool* getThreadPool() { return threadPool_.get(); }
     eng::engine::rendering::sfml::SFMLWindow* getWindow() { return window_.get(); }
     eng::engine::rendering::IRenderer* getRenderer() { return renderer_.get(); }
     Scripting::LuaState& getLuaState() { return Scripting::LuaState::Instance(); }
@@ -73,6 +75,7 @@ private:
 
     // Core subsystems
     std::unique_ptr<ECS::Coordinator> coordinator_;
+    std::unique_ptr<ECS::ThreadPool> threadPool_;  // Workers for SystemScheduler
     std::unique_ptr<eng::engine::rendering::sfml::SFMLWindow> window_;
     std::unique_ptr<eng::engine::rendering::IRenderer> renderer_;
     std::unique_ptr<StateManager> stateManager_;
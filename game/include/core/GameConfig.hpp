@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <ecs/Types.hpp>
 #include <string>
 
 struct GameConfig
@@ -48,6 +49,13 @@ struct GameConfig
         std::string spritesRoot = "assets/";
     } paths;
 
+    // ECS configuration
+    struct EcsConfig
+    {
+        // Cap on living entities; storage grows in pages, so raising it costs nothing up front
+        ECS::Entity maxEntities = ECS::DEFAULT_MAX_ENTITIES;
+    } ecs;
+
     // Audio configuration
     struct AudioConfig
     {
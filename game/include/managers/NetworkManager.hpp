@@ -273,7 +273,9 @@ private:
 
     // Lag compensation state
     uint32_t inputSequence_ = 0;       // Monotonic input counter
-    uint32_t lastSnapshotSeq_ = 0;     // Last received snapshot seq (for ordering)
+    uint32_t lastSnapshotSeq_ = 0;     // Last received snapshot seq (for ordering, acked as delta baseline)
+    bool needFullSnapshot_ = false;    // A delta could not be rebuilt: ack 0 until a full snapshot arrives
+    RType::SnapshotHistory snapshotHistory_; // Recent snapshots, baselines of incoming deltas
     float rtt_ = 0.0f;                 // Raw RTT in seconds
     float smoothedRtt_ = 0.0f;         // Exponential moving average RTT
     float pingTimer_ = 0.0f;           // Timer for periodic pings
@@ -281,6 +283,6 @@ private:
 
     // Helper methods
     void processIncomingPackets();
-    void handlePacket(const char* data, size_t length);
+    void handlePacket(const PacketView& packet);
     void sendPing();
 };
@@ -7,11 +7,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <string>
 #include <vector>
 #include <cstring>
+#include <network/BitStream.hpp>
 #include <network/Serializer.hpp>
 #include <network/Packet.hpp>
+#include <network/SnapshotHistory.hpp>
 
 namespace RType {
 
@@ -59,6 +63,19 @@ enum class EntityType : uint8_t {
     ENTITY_MODULE = 7
 };
 
+// Widths of the bit-packed wire encodings (see Network::BitWriter)
+namespace WireBits {
+    constexpr unsigned ENTITY_TYPE = 3; // EntityType values 0-7
+    constexpr unsigned INPUT_MASK  = 5; // up, down, left, right, fire
+    constexpr unsigned PLAYER_ID   = 8;
+    constexpr unsigned FIELD_MASK  = 12; // EntityDeltaBits without DELTA_CREATED
+    // Varint group sizes
+    constexpr unsigned SMALL = 3; // Types, lines, charge: almost always < 8, so 4 bits
+    constexpr unsigned COORD = 6; // Positions and velocities: |v| < 4096 fits 14 bits
+    constexpr unsigned COUNT = 4; // hp, score, counts and sequence gaps
+    constexpr unsigned SEQ   = 7; // Ever-growing ids and sequence numbers
+}
+
 #pragma pack(push, 1)
 
 // Input du client - identique au serveur
@@ -68,8 +85,9 @@ struct ClientInput {
     uint8_t inputMask;
     uint8_t chargeLevel;  // 0 = normal, 1-5 = charge levels
     uint32_t inputSeq;    // Monotonic input sequence number for prediction/reconciliation
+    uint32_t lastSnapshotSeq; // Last snapshot the client rebuilt, baseline for the next delta (0 = none)
 
-    ClientInput() : playerId(0), inputMask(0), chargeLevel(0), inputSeq(0) {}
+    ClientInput() : playerId(0), inputMask(0), chargeLevel(0), inputSeq(0), lastSnapshotSeq(0) {}
 
     std::vector<char> serialize() const {
         Network::Serializer serializer;
@@ -82,6 +100,25 @@ struct ClientInput {
         return deserializer.read<ClientInput>();
     }
 
+    // Bit-packed form used on the wire
+    void pack(Network::BitWriter& writer) const {
+        writer.writeBits(playerId, WireBits::PLAYER_ID);
+        writer.writeBits(inputMask, WireBits::INPUT_MASK);
+        writer.writeVarint(chargeLevel, WireBits::SMALL);
+        writer.writeVarint(inputSeq, WireBits::SEQ);
+        writer.writeVarint(lastSnapshotSeq, WireBits::SEQ);
+    }
+
+    static ClientInput unpack(Network::BitReader& reader) {
+        ClientInput input;
+        input.playerId = static_cast<uint8_t>(reader.readBits(WireBits::PLAYER_ID));
+        input.inputMask = static_cast<uint8_t>(reader.readBits(WireBits::INPUT_MASK));
+        input.chargeLevel = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        input.inputSeq = reader.readVarint(WireBits::SEQ);
+        input.lastSnapshotSeq = reader.readVarint(WireBits::SEQ);
+        return input;
+    }
+
     // Helper pour construire inputMask
     static uint8_t buildInputMask(bool up, bool down, bool left, bool right, bool fire) {
         uint8_t mask = 0;
@@ -96,11 +133,13 @@ struct ClientInput {
 
 // En-tête du snapshot
 struct SnapshotHeader {
-    uint32_t entityCount;
+    uint32_t entityCount;    // Entity records following the acks (creations and changes)
     uint32_t snapshotSeq;    // Monotonic snapshot counter for ordering
     uint8_t  playerAckCount; // Number of PlayerInputAck entries following this header
+    uint32_t baselineSeq;    // Snapshot the records are relative to (0 = full snapshot)
+    uint16_t removedCount;   // Entity ids removed since the baseline, after the records
 
-    SnapshotHeader() : entityCount(0), snapshotSeq(0), playerAckCount(0) {}
+    SnapshotHeader() : entityCount(0), snapshotSeq(0), playerAckCount(0), baselineSeq(0), removedCount(0) {}
 
     std::vector<char> serialize() const {
         Network::Serializer serializer;
@@ -112,6 +151,26 @@ struct SnapshotHeader {
         Network::Deserializer deserializer(data, sizeof(SnapshotHeader));
         return deserializer.read<SnapshotHeader>();
     }
+
+    // Bit-packed form used on the wire; the baseline travels as its age (0 = full snapshot)
+    void pack(Network::BitWriter& writer) const {
+        writer.writeVarint(entityCount, WireBits::COUNT);
+        writer.writeVarint(snapshotSeq, WireBits::SEQ);
+        writer.writeVarint(playerAckCount, WireBits::SMALL);
+        writer.writeVarint(baselineSeq != 0 ? snapshotSeq - baselineSeq : 0, WireBits::COUNT);
+        writer.writeVarint(removedCount, WireBits::COUNT);
+    }
+
+    static SnapshotHeader unpack(Network::BitReader& reader) {
+        SnapshotHeader header;
+        header.entityCount = reader.readVarint(WireBits::COUNT);
+        header.snapshotSeq = reader.readVarint(WireBits::SEQ);
+        header.playerAckCount = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        const uint32_t baselineAge = reader.readVarint(WireBits::COUNT);
+        header.baselineSeq = baselineAge != 0 ? header.snapshotSeq - baselineAge : 0;
+        header.removedCount = static_cast<uint16_t>(reader.readVarint(WireBits::COUNT));
+        return header;
+    }
 };
 
 // Per-player input acknowledgement included in snapshots
@@ -131,6 +190,36 @@ struct PlayerInputAck {
         Network::Deserializer deserializer(data, sizeof(PlayerInputAck));
         return deserializer.read<PlayerInputAck>();
     }
+
+    void pack(Network::BitWriter& writer) const {
+        writer.writeBits(playerId, WireBits::PLAYER_ID);
+        writer.writeVarint(lastProcessedInputSeq, WireBits::SEQ);
+    }
+
+    static PlayerInputAck unpack(Network::BitReader& reader) {
+        PlayerInputAck ack;
+        ack.playerId = static_cast<uint8_t>(reader.readBits(WireBits::PLAYER_ID));
+        ack.lastProcessedInputSeq = reader.readVarint(WireBits::SEQ);
+        return ack;
+    }
+};
+
+// Fields present in a WORLD_SNAPSHOT entity record
+enum EntityDeltaBits : uint16_t {
+    DELTA_TYPE            = 1 << 0,
+    DELTA_X               = 1 << 1,
+    DELTA_Y               = 1 << 2,
+    DELTA_VX              = 1 << 3,
+    DELTA_VY              = 1 << 4,
+    DELTA_HP              = 1 << 5,
+    DELTA_PLAYER_LINE     = 1 << 6,
+    DELTA_PLAYER_ID       = 1 << 7,
+    DELTA_CHARGE_LEVEL    = 1 << 8,
+    DELTA_ENEMY_TYPE      = 1 << 9,
+    DELTA_PROJECTILE_TYPE = 1 << 10,
+    DELTA_SCORE           = 1 << 11,
+    DELTA_ALL             = (1 << 12) - 1,
+    DELTA_CREATED         = 1 << 15  // Not in the baseline: missing fields take EntityState() defaults
 };
 
 // État d'une entité dans le snapshot
@@ -163,15 +252,82 @@ struct EntityState {
         Network::Deserializer deserializer(data, sizeof(EntityState));
         return deserializer.read<EntityState>();
     }
+
+    // EntityDeltaBits of the fields that differ from `base`
+    uint16_t diff(const EntityState& base) const {
+        uint16_t mask = 0;
+        if (type != base.type)                     mask |= DELTA_TYPE;
+        if (x != base.x)                           mask |= DELTA_X;
+        if (y != base.y)                           mask |= DELTA_Y;
+        if (vx != base.vx)                         mask |= DELTA_VX;
+        if (vy != base.vy)                         mask |= DELTA_VY;
+        if (hp != base.hp)                         mask |= DELTA_HP;
+        if (playerLine != base.playerLine)         mask |= DELTA_PLAYER_LINE;
+        if (playerId != base.playerId)             mask |= DELTA_PLAYER_ID;
+        if (chargeLevel != base.chargeLevel)       mask |= DELTA_CHARGE_LEVEL;
+        if (enemyType != base.enemyType)           mask |= DELTA_ENEMY_TYPE;
+        if (projectileType != base.projectileType) mask |= DELTA_PROJECTILE_TYPE;
+        if (score != base.score)                   mask |= DELTA_SCORE;
+        return mask;
+    }
+
+    // Bit-packed masked fields, in declaration order
+    void packFields(Network::BitWriter& writer, uint16_t mask) const {
+        if (mask & DELTA_TYPE)            writer.writeBits(static_cast<uint8_t>(type), WireBits::ENTITY_TYPE);
+        if (mask & DELTA_X)               writer.writeSignedVarint(x, WireBits::COORD);
+        if (mask & DELTA_Y)               writer.writeSignedVarint(y, WireBits::COORD);
+        if (mask & DELTA_VX)              writer.writeSignedVarint(vx, WireBits::COORD);
+        if (mask & DELTA_VY)              writer.writeSignedVarint(vy, WireBits::COORD);
+        if (mask & DELTA_HP)              writer.writeVarint(hp, WireBits::COUNT);
+        if (mask & DELTA_PLAYER_LINE)     writer.writeVarint(playerLine, WireBits::SMALL);
+        if (mask & DELTA_PLAYER_ID)       writer.writeBits(playerId, WireBits::PLAYER_ID);
+        if (mask & DELTA_CHARGE_LEVEL)    writer.writeVarint(chargeLevel, WireBits::SMALL);
+        if (mask & DELTA_ENEMY_TYPE)      writer.writeVarint(enemyType, WireBits::SMALL);
+        if (mask & DELTA_PROJECTILE_TYPE) writer.writeVarint(projectileType, WireBits::SMALL);
+        if (mask & DELTA_SCORE)           writer.writeVarint(score, WireBits::COUNT);
+    }
+
+    // Overwrites the masked fields with those written by packFields
+    void unpackFields(Network::BitReader& reader, uint16_t mask) {
+        if (mask & DELTA_TYPE)            type = static_cast<EntityType>(reader.readBits(WireBits::ENTITY_TYPE));
+        if (mask & DELTA_X)               x = static_cast<int16_t>(reader.readSignedVarint(WireBits::COORD));
+        if (mask & DELTA_Y)               y = static_cast<int16_t>(reader.readSignedVarint(WireBits::COORD));
+        if (mask & DELTA_VX)              vx = static_cast<int16_t>(reader.readSignedVarint(WireBits::COORD));
+        if (mask & DELTA_VY)              vy = static_cast<int16_t>(reader.readSignedVarint(WireBits::COORD));
+        if (mask & DELTA_HP)              hp = static_cast<uint16_t>(reader.readVarint(WireBits::COUNT));
+        if (mask & DELTA_PLAYER_LINE)     playerLine = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        if (mask & DELTA_PLAYER_ID)       playerId = static_cast<uint8_t>(reader.readBits(WireBits::PLAYER_ID));
+        if (mask & DELTA_CHARGE_LEVEL)    chargeLevel = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        if (mask & DELTA_ENEMY_TYPE)      enemyType = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        if (mask & DELTA_PROJECTILE_TYPE) projectileType = static_cast<uint8_t>(reader.readVarint(WireBits::SMALL));
+        if (mask & DELTA_SCORE)           score = reader.readVarint(WireBits::COUNT);
+    }
+
+    // Full bit-packed state: about half of sizeof(EntityState) for a typical monster
+    void pack(Network::BitWriter& writer) const {
+        writer.writeVarint(id, WireBits::SEQ);
+        packFields(writer, DELTA_ALL);
+    }
+
+    static EntityState unpack(Network::BitReader& reader) {
+        EntityState state;
+        state.id = reader.readVarint(WireBits::SEQ);
+        state.unpackFields(reader, DELTA_ALL);
+        return state;
+    }
 };
 
 #pragma pack(pop)
 
+// Snapshots a peer keeps around as delta baselines
+using SnapshotHistory = Network::SnapshotHistory<EntityState>;
+
 // Parsed world snapshot data
 struct WorldSnapshotData {
     SnapshotHeader header;
     std::vector<PlayerInputAck> acks;
-    std::vector<EntityState> entities;
+    std::vector<EntityState> entities; // Full state, sorted by id
+    std::vector<uint32_t> removedIds;  // Entities gone since the baseline
 };
 
 // Fonctions utilitaires de protocole
@@ -180,39 +336,92 @@ public:
     // Créer un paquet CLIENT_INPUT
     static NetworkPacket createInputPacket(const ClientInput& input) {
         NetworkPacket packet(static_cast<uint16_t>(GamePacketType::CLIENT_INPUT));
-        packet.setPayload(input.serialize());
+        Network::BitWriter writer;
+        input.pack(writer);
+        packet.setPayload(writer.getBuffer());
         return packet;
     }
 
-    // Parser un WORLD_SNAPSHOT (new format: header + acks + entities)
-    static WorldSnapshotData parseWorldSnapshot(const NetworkPacket& packet) {
-        if (packet.header.type != static_cast<uint16_t>(GamePacketType::WORLD_SNAPSHOT)) {
+    /**
+     * Parses a WORLD_SNAPSHOT into the full entity list. A delta
+     * snapshot needs its baseline in `history`; throws when it is not
+     * there (the client then acks 0 to get a full snapshot). Reads the
+     * payload in place, e.g. straight from a received PacketView.
+     */
+    static WorldSnapshotData parseWorldSnapshot(const PacketHeader& header, Network::ByteSpan payload,
+                                                const SnapshotHistory& history) {
+        if (header.type != static_cast<uint16_t>(GamePacketType::WORLD_SNAPSHOT)) {
             throw std::runtime_error("Invalid packet type for WORLD_SNAPSHOT");
         }
 
-        const char* data = packet.payload.data();
-        size_t offset = 0;
-        WorldSnapshotData result;
+        WorldSnapshotData data;
+        Network::BitReader reader(payload.data(), payload.size());
+        data.header = SnapshotHeader::unpack(reader);
 
-        // Read header
-        result.header = SnapshotHeader::deserialize(data);
-        offset += sizeof(SnapshotHeader);
+        const std::vector<EntityState>* baseline = nullptr;
+        if (data.header.baselineSeq != 0) {
+            baseline = history.find(data.header.baselineSeq);
+            if (!baseline) {
+                throw std::runtime_error("WORLD_SNAPSHOT baseline " + std::to_string(data.header.baselineSeq) + " not available");
+            }
+        }
 
-        // Read player input acks
-        result.acks.reserve(result.header.playerAckCount);
-        for (uint8_t i = 0; i < result.header.playerAckCount; ++i) {
-            result.acks.push_back(PlayerInputAck::deserialize(data + offset));
-            offset += sizeof(PlayerInputAck);
+        data.acks.reserve(data.header.playerAckCount);
+        for (uint8_t i = 0; i < data.header.playerAckCount; ++i) {
+            data.acks.push_back(PlayerInputAck::unpack(reader));
         }
 
-        // Read entities
-        result.entities.reserve(result.header.entityCount);
-        for (uint32_t i = 0; i < result.header.entityCount; ++i) {
-            result.entities.push_back(EntityState::deserialize(data + offset));
-            offset += sizeof(EntityState);
+        std::vector<EntityState> records;
+        records.reserve(data.header.entityCount);
+        uint32_t previousId = 0;
+        for (uint32_t i = 0; i < data.header.entityCount; ++i) {
+            EntityState state;
+            state.id = previousId + static_cast<uint32_t>(reader.readSignedVarint(WireBits::COUNT));
+            previousId = state.id;
+            const bool created = reader.readBool();
+            const uint16_t mask = static_cast<uint16_t>(reader.readBits(WireBits::FIELD_MASK));
+            if (!created) {
+                if (!baseline) {
+                    throw std::runtime_error("WORLD_SNAPSHOT update record in a full snapshot");
+                }
+                auto it = std::lower_bound(baseline->begin(), baseline->end(), state.id,
+                                           [](const EntityState& e, uint32_t id) { return e.id < id; });
+                if (it == baseline->end() || it->id != state.id) {
+                    throw std::runtime_error("WORLD_SNAPSHOT update for unknown entity " + std::to_string(state.id));
+                }
+                state = *it;
+            }
+            state.unpackFields(reader, mask);
+            records.push_back(state);
         }
 
-        return result;
+        data.removedIds.reserve(data.header.removedCount);
+        previousId = 0;
+        for (uint16_t i = 0; i < data.header.removedCount; ++i) {
+            previousId += static_cast<uint32_t>(reader.readSignedVarint(WireBits::COUNT));
+            data.removedIds.push_back(previousId);
+        }
+
+        // Baseline minus removals, with the records laid over it
+        auto byId = [](const EntityState& a, const EntityState& b) { return a.id < b.id; };
+        std::sort(records.begin(), records.end(), byId);
+        std::sort(data.removedIds.begin(), data.removedIds.end());
+        data.entities.reserve(records.size() + (baseline ? baseline->size() : 0));
+        size_t r = 0;
+        if (baseline) {
+            for (const auto& state : *baseline) {
+                while (r < records.size() && records[r].id < state.id) {
+                    data.entities.push_back(records[r++]);
+                }
+                if (r < records.size() && records[r].id == state.id) {
+                    data.entities.push_back(records[r++]);
+                } else if (!std::binary_search(data.removedIds.begin(), data.removedIds.end(), state.id)) {
+                    data.entities.push_back(state);
+                }
+            }
+        }
+        data.entities.insert(data.entities.end(), records.begin() + r, records.end());
+        return data;
     }
 };
 
@@ -13,6 +13,8 @@
 #include "network/RTypeProtocol.hpp"
 #include <ecs/Types.hpp>
 #include <rendering/Types.hpp>
+#include <rendering/Camera.hpp>
+#include <rendering/sfml/SFMLTextureAtlas.hpp>
 #include <memory>
 #include <vector>
 #include <deque>
@@ -119,6 +121,7 @@ private:
 
     // Systems (stored as shared_ptr)
     std::shared_ptr<RenderSystem> renderSystem_;
+    eng::engine::rendering::Camera camera_;
     std::shared_ptr<AnimationSystem> animationSystem_;
     std::shared_ptr<ScrollingBackgroundSystem> scrollingSystem_;
 
@@ -146,6 +149,7 @@ private:
     bool shieldActive_ = false;
 
     // Loaded sprites/textures (we own them)
+    eng::engine::rendering::sfml::SFMLTextureAtlas textureAtlas_;
     std::vector<std::unique_ptr<eng::engine::rendering::sfml::SFMLTexture>> loadedTextures_;
     std::vector<std::unique_ptr<eng::engine::rendering::sfml::SFMLSprite>> loadedSprites_;
     
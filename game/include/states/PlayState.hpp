@@ -6,7 +6,11 @@
 
 #include "GameState.hpp"
 #include <ecs/Types.hpp>
+#include <ecs/CommandBuffer.hpp>
+#include <physics/CollisionLayers.hpp>
 #include <rendering/Types.hpp>
+#include <rendering/Camera.hpp>
+#include <rendering/sfml/SFMLTextureAtlas.hpp>
 #include <scripting/LuaState.hpp>
 #include <memory>
 #include <vector>
@@ -16,6 +20,7 @@
 // Forward declarations
 namespace ECS {
     class Coordinator;
+    class SystemScheduler;
 }
 struct Position;  // Forward declare Position component
 namespace eng::engine::rendering {
@@ -101,12 +106,14 @@ private:
     void checkCollectableCollisions();  // Check collisions with player
     void pickupPowerup(ECS::Entity powerupEntity, const std::string& type);
     void attachModule(ECS::Entity moduleEntity, const std::string& moduleType);
+    bool hasEquippedModule();  // Module still alive and of a known type
+    void untrackEnemy(ECS::Entity enemy);  // Drop from activeEnemies_ and the per-enemy maps
     void updateAttachedModule();  // Update module position to follow player
     
     eng::engine::rendering::ISprite* loadSprite(const std::string& texturePath, const eng::engine::rendering::IntRect* rect = nullptr);
 
     // Player state
-    ECS::Entity playerEntity_;
+    ECS::EntityHandle playerEntity_;  // Null until spawnPlayer
     float shootCooldown_;
     float timeSinceLastShot_;
     bool isCharging_;
@@ -121,25 +128,34 @@ private:
     std::shared_ptr<InputSystem> inputSystem_;
     std::shared_ptr<MovementSystem> movementSystem_;
     std::shared_ptr<RenderSystem> renderSystem_;
+    eng::engine::rendering::Camera camera_;
     std::shared_ptr<AnimationSystem> animationSystem_;
     std::shared_ptr<CollisionSystem> collisionSystem_;
     std::shared_ptr<ScrollingBackgroundSystem> scrollingSystem_;
     std::shared_ptr<LifetimeSystem> lifetimeSystem_;
     std::shared_ptr<BoundarySystem> boundarySystem_;
 
+    // Runs the independent per-frame systems (scrolling, lifetime, animation) concurrently
+    std::unique_ptr<ECS::SystemScheduler> systemScheduler_;
+
     // Charge animation entity
     ECS::Entity chargeIndicatorEntity_;
     
     // Equipped module tracking
-    ECS::Entity equippedModuleEntity_;  // Entity of the attached module (0 if none)
+    ECS::EntityHandle equippedModuleEntity_;  // Attached module (null if none, stale once destroyed)
     std::string equippedModuleType_;    // Type of equipped module ("laser", "homing", etc.)
     ECS::Entity laserBeamEntity_;       // Entity of the active laser beam (0 if none)
 
     // Enemy tracking for optimized iteration
-    std::vector<ECS::Entity> activeEnemies_;  // Track all spawned enemies for efficient updates
+    std::vector<ECS::EntityHandle> activeEnemies_;  // Track all spawned enemies for efficient updates (pruned by IsAlive)
     std::vector<ECS::Entity> activeCollectables_; // Track powerups/modules for efficient pickup checks
     std::unordered_set<ECS::Entity> kamikazeEntities_; // Enemies with homing_player movement pattern
 
+    // Entities destroyed/spawned by the collision callback, applied after the collision pass
+    ECS::CommandBuffer collisionCommands_;
+    // Tag -> collider layer/mask, so only pairs the callback handles are generated
+    eng::engine::physics::CollisionLayerTable collisionLayers_;
+
     // Game config from Lua
     int windowWidth_;
     int windowHeight_;
@@ -170,6 +186,7 @@ private:
     std::unordered_map<ECS::Entity, std::string> enemyFirePatterns_;
 
     // Loaded sprites/textures (we own them)
+    eng::engine::rendering::sfml::SFMLTextureAtlas textureAtlas_;
     std::vector<std::unique_ptr<eng::engine::rendering::sfml::SFMLTexture>> loadedTextures_;
     std::vector<std::unique_ptr<eng::engine::rendering::sfml::SFMLSprite>> loadedSprites_;
     
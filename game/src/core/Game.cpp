@@ -97,9 +97,13 @@ bool Game::initialize()
 
     // Create ECS Coordinator
     coordinator_ = std::make_unique<ECS::Coordinator>();
-    coordinator_->Init();
+    coordinator_->Init(ECS::StorageMode::SparseSet, config_.ecs.maxEntities);
     LOG_INFO("GAME", "ECS initialized");
 
+    // Worker threads for systems scheduled in parallel (simulation keeps the main thread)
+    threadPool_ = std::make_unique<ECS::ThreadPool>();
+    LOG_INFO("GAME", "Thread pool started with " + std::to_string(threadPool_->WorkerCount()) + " workers");
+
     // Setup ECS (register components and systems)
     setupECS();
 
@@ -644,7 +648,7 @@ void Game::resetCoordinator()
 
     // Recreate from scratch
     coordinator_ = std::make_unique<ECS::Coordinator>();
-    coordinator_->Init();
+    coordinator_->Init(ECS::StorageMode::SparseSet, config_.ecs.maxEntities);
 
     // Re-register components and base systems (UISystem)
     setupECS();
@@ -281,6 +281,7 @@ void NetworkManager::sendInput(bool up, bool down, bool left, bool right, bool f
     input.inputMask = RType::ClientInput::buildInputMask(up, down, left, right, fire);
     input.chargeLevel = chargeLevel;
     input.inputSeq = ++inputSequence_;
+    input.lastSnapshotSeq = needFullSnapshot_ ? 0 : lastSnapshotSeq_;
 
     // Create and send packet
     NetworkPacket packet = RType::Protocol::createInputPacket(input);
@@ -344,26 +345,18 @@ void NetworkManager::sendPing() {
 
 void NetworkManager::processIncomingPackets() {
     while (client_->hasReceivedPackets()) {
-        NetworkPacket packet = client_->getNextReceivedPacket();
-        
-        // Serialize packet to get raw data for handlePacket
-        auto serialized = packet.serialize();
-        handlePacket(serialized.data(), serialized.size());
+        PacketView packet = client_->getNextReceivedPacket();
+        handlePacket(packet);
     }
 }
 
-void NetworkManager::handlePacket(const char* data, size_t length) {
-    if (length < sizeof(PacketHeader)) {
-        return;
-    }
-
-    // Read packet type from header
-    PacketHeader header = PacketHeader::deserialize(data);
+void NetworkManager::handlePacket(const PacketView& packet) {
+    // Header is already decoded, payload still lives in the pooled buffer
+    const PacketHeader& header = packet.header;
     auto type = static_cast<Network::PacketType>(header.type);
 
-    // Payload starts after header
-    const char* payload = data + sizeof(PacketHeader);
-    size_t payloadSize = length - sizeof(PacketHeader);
+    const char* payload = packet.payload.data();
+    size_t payloadSize = packet.payload.size();
 
     switch (type) {
         case Network::PacketType::SERVER_ACCEPT: {
@@ -540,6 +533,10 @@ void NetworkManager::handlePacket(const char* data, size_t length) {
         case Network::PacketType::GAME_START: {
             LOG_INFO("NetworkManager", "Game starting!");
             inGame_ = true;  // Mark as in game
+            // Baselines of a previous game are meaningless to the new one
+            snapshotHistory_.clear();
+            lastSnapshotSeq_ = 0;
+            needFullSnapshot_ = false;
             if (gameStartCallback_) {
                 gameStartCallback_();
             }
@@ -553,17 +550,24 @@ void NetworkManager::handlePacket(const char* data, size_t length) {
             }
 
             try {
-                // Parse the full packet (header + payload were passed as data)
-                NetworkPacket fullPacket = NetworkPacket::deserialize(data, length);
-
-                // Parse world snapshot (new format with acks)
-                RType::WorldSnapshotData snapshotData = RType::Protocol::parseWorldSnapshot(fullPacket);
-
                 // Reject out-of-order snapshots
-                if (snapshotData.header.snapshotSeq <= lastSnapshotSeq_ && lastSnapshotSeq_ > 0) {
+                Network::BitReader headerReader(payload, payloadSize);
+                RType::SnapshotHeader snapshotHeader = RType::SnapshotHeader::unpack(headerReader);
+                if (snapshotHeader.snapshotSeq <= lastSnapshotSeq_ && lastSnapshotSeq_ > 0) {
                     break;
                 }
+
+                // Rebuild the full entity list on top of the baseline the server diffed against
+                RType::WorldSnapshotData snapshotData;
+                try {
+                    snapshotData = RType::Protocol::parseWorldSnapshot(header, packet.payload, snapshotHistory_);
+                } catch (const std::exception&) {
+                    needFullSnapshot_ = true;
+                    throw;
+                }
+                needFullSnapshot_ = false;
                 lastSnapshotSeq_ = snapshotData.header.snapshotSeq;
+                snapshotHistory_.store(lastSnapshotSeq_, snapshotData.entities);
 
                 // Call snapshot callback with full data (entities + acks)
                 if (onWorldSnapshot_) {
@@ -577,10 +581,9 @@ void NetworkManager::handlePacket(const char* data, size_t length) {
         }
 
         case Network::PacketType::LEVEL_CHANGE: {
-            if (length >= sizeof(PacketHeader) + 1) {
-                // Extract level ID from payload (first byte after header)
-                const char* payloadStart = data + sizeof(PacketHeader);
-                uint8_t newLevel = static_cast<uint8_t>(*payloadStart);
+            if (payloadSize >= 1) {
+                // Extract level ID from payload (first byte)
+                uint8_t newLevel = static_cast<uint8_t>(payload[0]);
                 LOG_INFO("NetworkManager", (std::ostringstream{} << "LEVEL_CHANGE received: Level " << (int)newLevel).str());
                 if (onLevelChange_) {
                     onLevelChange_(newLevel);
@@ -14,6 +14,7 @@
 #include "managers/MusicManager.hpp"
 #include "managers/SFXManager.hpp"
 #include <ecs/Coordinator.hpp>
+#include <ecs/CommandBuffer.hpp>
 #include <components/Position.hpp>
 #include <components/Velocity.hpp>
 #include <components/Sprite.hpp>
@@ -164,6 +165,11 @@ void NetworkPlayState::onExit()
     }
     networkEntities_.clear();
 
+    // The render system outlives this state in the coordinator
+    if (renderSystem_) {
+        renderSystem_->SetCamera(nullptr);
+    }
+
     // Clean up spectator overlay
     spectatorText_.reset();
     spectatorSubText_.reset();
@@ -189,6 +195,11 @@ void NetworkPlayState::setupSystems()
     if (renderSystem_) {
         renderSystem_->SetCoordinator(coordinator);
         renderSystem_->SetRenderer(game_->getRenderer());
+        // Same area as the window's default view: culls what left the screen but is not destroyed yet
+        const auto& windowConfig = game_->getConfig().window;
+        camera_.setViewport(eng::engine::rendering::IntRect(0, 0, static_cast<int>(windowConfig.width), static_cast<int>(windowConfig.height)));
+        camera_.setPosition(eng::engine::rendering::Vector2f(windowConfig.width / 2.0f, windowConfig.height / 2.0f));
+        renderSystem_->SetCamera(&camera_);
     }
     if (animationSystem_) {
         animationSystem_->SetCoordinator(coordinator);
@@ -307,6 +318,20 @@ void NetworkPlayState::loadLevelNamesFromLua()
 
 eng::engine::rendering::ISprite* NetworkPlayState::loadSprite(const std::string& texturePath, const eng::engine::rendering::IntRect* rect)
 {
+    // Sprite sheets share atlas pages (one texture, batched draws); large images keep their own
+    eng::engine::rendering::sfml::SFMLTextureAtlas::Region region;
+    if (textureAtlas_.acquire(texturePath, region)) {
+        auto sprite = std::make_unique<eng::engine::rendering::sfml::SFMLSprite>();
+        sprite->setTexture(region.texture);
+        sprite->setAtlasRegion(region.rect);
+        if (rect && (rect->width != 0 || rect->height != 0)) {
+            sprite->setTextureRect(*rect);
+        }
+        eng::engine::rendering::ISprite* spritePtr = sprite.get();
+        loadedSprites_.push_back(std::move(sprite));
+        return spritePtr;
+    }
+
     auto texture = std::make_unique<eng::engine::rendering::sfml::SFMLTexture>();
     if (!texture->loadFromFile(texturePath)) {
         LOG_ERROR("NETWORKPLAY", "ERROR: Failed to load texture: " + texturePath);
@@ -841,9 +866,11 @@ void NetworkPlayState::removeStaleEntities(const std::vector<RType::EntityState>
         }
     }
 
+    // Destroy in one batch once the bookkeeping below is done
+    ECS::CommandBuffer commands(coordinator);
     for (uint32_t id : toRemove) {
         ECS::Entity entity = networkEntities_[id];
-        coordinator->DestroyEntity(entity);
+        commands.DestroyEntity(entity);
         networkEntities_.erase(id);
         
         if (entity == localPlayerEntity_) {
@@ -875,6 +902,7 @@ void NetworkPlayState::removeStaleEntities(const std::vector<RType::EntityState>
             LOG_INFO("NETWORKPLAY", " Boss destroyed!");
         }
     }
+    commands.Flush();
 }
 
 void NetworkPlayState::spawnChargeIndicator()
@@ -6,6 +6,8 @@
 #include "managers/MusicManager.hpp"
 #include "managers/SFXManager.hpp"
 #include <ecs/Coordinator.hpp>
+#include <ecs/CommandBuffer.hpp>
+#include <ecs/SystemScheduler.hpp>
 #include <rendering/IRenderer.hpp>
 #include <components/Position.hpp>
 #include <components/Velocity.hpp>
@@ -242,9 +244,7 @@ static SoloLevelConfig getSoloLevelConfig(int level) {
 // ==========================================
 
 PlayState::PlayState(Game* game)
-    : playerEntity_(0)
-    , chargeIndicatorEntity_(0)
-    , equippedModuleEntity_(0)
+    : chargeIndicatorEntity_(0)
     , shootCooldown_(0.15f)
     , timeSinceLastShot_(0.0f)
     , isCharging_(false)
@@ -386,14 +386,15 @@ void PlayState::onExit()
     auto coordinator = game_->getCoordinator();
     
     // Save highscore before destroying player
-    if (coordinator && playerEntity_ != 0 && coordinator->HasComponent<Score>(playerEntity_)) {
-        auto& score = coordinator->GetComponent<Score>(playerEntity_);
+    if (coordinator && coordinator->IsAlive(playerEntity_)) {
+        auto& score = coordinator->GetComponent<Score>(playerEntity_.index);
         if (score.current > score.highScore) {
             saveHighScore(score.current);
         }
     }
 
     // Nullify system pointers before the reset (they will become dangling)
+    systemScheduler_.reset();
     inputSystem_    = nullptr;
     movementSystem_ = nullptr;
     renderSystem_   = nullptr;
@@ -403,6 +404,10 @@ void PlayState::onExit()
     lifetimeSystem_ = nullptr;
     boundarySystem_ = nullptr;
 
+    // Pending commands target the coordinator about to be reset
+    collisionCommands_.Clear();
+    collisionCommands_.SetCoordinator(nullptr);
+
     // Reset the ECS coordinator so systems can be re-registered on next play
     game_->resetCoordinator();
 
@@ -431,6 +436,11 @@ void PlayState::setupSystems()
     if (renderSystem_) {
         renderSystem_->SetCoordinator(coordinator);
         renderSystem_->SetRenderer(game_->getRenderer());
+        // Same area as the window's default view: culls what left the screen but is not destroyed yet
+        const auto& windowConfig = game_->getConfig().window;
+        camera_.setViewport(eng::engine::rendering::IntRect(0, 0, static_cast<int>(windowConfig.width), static_cast<int>(windowConfig.height)));
+        camera_.setPosition(eng::engine::rendering::Vector2f(windowConfig.width / 2.0f, windowConfig.height / 2.0f));
+        renderSystem_->SetCamera(&camera_);
     }
     if (animationSystem_) {
         animationSystem_->SetCoordinator(coordinator);
@@ -485,6 +495,14 @@ void PlayState::setupSystems()
         // std::cout << "[PlayState] BoundarySystem signature set (Position + Boundary)" << std::endl;
     }
 
+    // CollisionSystem: Position + Collider (only these entities enter the broad phase)
+    {
+        ECS::Signature sig;
+        sig.set(coordinator->GetComponentType<Position>());
+        sig.set(coordinator->GetComponentType<Collider>());
+        coordinator->SetSystemSignature<CollisionSystem>(sig);
+    }
+
     // Initialize systems
     if (inputSystem_) inputSystem_->Init();
     if (movementSystem_) movementSystem_->Init();
@@ -495,14 +513,35 @@ void PlayState::setupSystems()
     if (lifetimeSystem_) lifetimeSystem_->Init();
     if (boundarySystem_) boundarySystem_->Init();
 
+    // Per-entity loops large enough to be worth splitting across the pool
+    if (movementSystem_) movementSystem_->SetThreadPool(game_->getThreadPool());
+    if (lifetimeSystem_) lifetimeSystem_->SetThreadPool(game_->getThreadPool());
+
+    // These systems touch disjoint components, so the scheduler may run them
+    // side by side; expired entities are destroyed once all three are done
+    systemScheduler_ = std::make_unique<ECS::SystemScheduler>(coordinator, game_->getThreadPool());
+    if (scrollingSystem_) systemScheduler_->Add(scrollingSystem_).Reads<ScrollingBackground>().Writes<Position>();
+    if (lifetimeSystem_) systemScheduler_->Add(lifetimeSystem_).Writes<Lifetime>();
+    if (animationSystem_) systemScheduler_->Add(animationSystem_).Writes<Animation, Sprite>();
+
     // std::cout << "[PlayState] Systems registered and initialized" << std::endl;
 
     // Set up collision callback for game-specific logic
+    // Collision layers: only the pairs the callback below reacts to reach it
+    collisionLayers_.setCollides("player", "enemy");
+    collisionLayers_.setCollides("player", "enemy_projectile");
+    collisionLayers_.setCollides("player_projectile", "enemy");
+
     if (collisionSystem_) {
+        collisionCommands_.SetCoordinator(coordinator);
         collisionSystem_->SetCollisionCallback([this](ECS::Entity a, ECS::Entity b) {
             auto coordinator = game_->getCoordinator();
             if (!coordinator) return;
 
+            // Destruction is deferred to the end of the collision pass: an entity
+            // already queued for it must not hit (or be hit) again this frame
+            if (collisionCommands_.IsDestroyQueued(a) || collisionCommands_.IsDestroyQueued(b)) return;
+
             // Helper: get tag name safely
             auto getTag = [&](ECS::Entity e) -> std::string {
                 if (coordinator->HasComponent<Tag>(e)) {
@@ -523,12 +562,6 @@ void PlayState::setupSystems()
             auto isPlayerProj = [](const std::string& t) { return t == "player_projectile"; };
             auto isEnemyProj = [](const std::string& t) { return t == "enemy_projectile"; };
 
-            // Ignore enemy projectile vs enemy collisions
-            if ((isEnemyProj(tagA) && isEnemy(tagB)) || (isEnemy(tagA) && isEnemyProj(tagB))) {
-                // std::cout << "[Collision] ⏭  Ignored: enemy_projectile <-> enemy collision" << std::endl;
-                return;
-            }
-
             // Helper: apply damage to target
             auto applyDamage = [&](ECS::Entity target, int dmg, ECS::Entity source, bool allowInvulnerability = true) {
                 if (!coordinator->HasComponent<Health>(target)) {
@@ -585,13 +618,13 @@ void PlayState::setupSystems()
                                     
                                     if (explosionConfig.valid()) {
                                         // std::cout << "[Collision]  explosionConfig is valid, creating explosion entity..." << std::endl;
-                                ECS::Entity explosion = coordinator->CreateEntity();
+                                ECS::Entity explosion = collisionCommands_.CreateEntity();
                                 
                                 // Position
                                 Position explosionPos;
                                 explosionPos.x = pos.x;
                                 explosionPos.y = pos.y;
-                                coordinator->AddComponent(explosion, explosionPos);
+                                collisionCommands_.AddComponent(explosion, explosionPos);
                                 
                                 // Read sprite config from Lua
                                 std::string spritePath = explosionConfig["texture_path"].get_or<std::string>("assets/vfx/dead_enemies_animation.png");
@@ -619,7 +652,7 @@ void PlayState::setupSystems()
                                 explosionSprite.scaleX = scaleX;
                                 explosionSprite.scaleY = scaleY;
                                 explosionSprite.sprite = loadSprite(explosionSprite.texturePath, &explosionSprite.textureRect);
-                                coordinator->AddComponent(explosion, explosionSprite);
+                                collisionCommands_.AddComponent(explosion, explosionSprite);
                                 
                                 // Animation
                                 Animation explosionAnim;
@@ -634,14 +667,14 @@ void PlayState::setupSystems()
                                 explosionAnim.loop = loop;
                                 explosionAnim.finished = false;
                                 explosionAnim.spacing = 0;
-                                coordinator->AddComponent(explosion, explosionAnim);
+                                collisionCommands_.AddComponent(explosion, explosionAnim);
                                 
                                 // Auto-destroy after animation
                                 float totalDuration = frameCount * frameTime;
                                 Lifetime explosionLife;
                                 explosionLife.maxLifetime = totalDuration;
                                 explosionLife.destroyOnExpire = true;
-                                coordinator->AddComponent(explosion, explosionLife);
+                                collisionCommands_.AddComponent(explosion, explosionLife);
                                 
                                 // std::cout << "[Collision]  Spawned explosion animation at (" << pos.x << ", " << pos.y 
                                           // << ") - " << frameCount << " frames @ " << frameTime << "s/frame" << std::endl;
@@ -656,16 +689,10 @@ void PlayState::setupSystems()
                         
                         // Remove from active enemies list if it's an enemy
                         if (isEnemy(getTag(target))) {
-                            activeEnemies_.erase(
-                                std::remove(activeEnemies_.begin(), activeEnemies_.end(), target),
-                                activeEnemies_.end()
-                            );
-                            // Also remove from fire patterns map and kamikaze set
-                            enemyFirePatterns_.erase(target);
-                            kamikazeEntities_.erase(target);
+                            untrackEnemy(target);
                         }
                         
-                        coordinator->DestroyEntity(target);
+                        collisionCommands_.DestroyEntity(target);
                         // std::cout << "[Collision]   Entity " << target << " destroyed!" << std::endl;
                     }
                 }
@@ -676,7 +703,7 @@ void PlayState::setupSystems()
                 // Check if shield is active
                 if (shieldActive_) {
                     // std::cout << "[Collision]  Shield blocked attack from " << tagB << "!" << std::endl;
-                    if (b != bossEntity_) coordinator->DestroyEntity(b); // Don't destroy the boss
+                    if (b != bossEntity_) collisionCommands_.DestroyEntity(b); // Don't destroy the boss
                     return;
                 }
                 
@@ -692,7 +719,7 @@ void PlayState::setupSystems()
                 } else {
                     applyDamage(a, dmg, b, true); // Player: enable invulnerability
                     // Destroy enemy projectiles AND enemies on contact with player
-                    coordinator->DestroyEntity(b);
+                    collisionCommands_.DestroyEntity(b);
                 }
                 return;
             }
@@ -700,7 +727,7 @@ void PlayState::setupSystems()
                 // Check if shield is active
                 if (shieldActive_) {
                     // std::cout << "[Collision]  Shield blocked attack from " << tagA << "!" << std::endl;
-                    if (a != bossEntity_) coordinator->DestroyEntity(a);
+                    if (a != bossEntity_) collisionCommands_.DestroyEntity(a);
                     return;
                 }
                 
@@ -716,7 +743,7 @@ void PlayState::setupSystems()
                 } else {
                     applyDamage(b, dmg, a, true); // Player: enable invulnerability
                     // Destroy enemy projectiles AND enemies on contact with player
-                    coordinator->DestroyEntity(a);
+                    collisionCommands_.DestroyEntity(a);
                 }
                 return;
             }
@@ -731,7 +758,7 @@ void PlayState::setupSystems()
                 
                 // Don't destroy laser beams - only regular projectiles
                 if (!coordinator->HasComponent<LaserBeam>(a)) {
-                    coordinator->DestroyEntity(a);
+                    collisionCommands_.DestroyEntity(a);
                 }
                 return;
             }
@@ -744,20 +771,10 @@ void PlayState::setupSystems()
                 
                 // Don't destroy laser beams - only regular projectiles
                 if (!coordinator->HasComponent<LaserBeam>(b)) {
-                    coordinator->DestroyEntity(b);
+                    collisionCommands_.DestroyEntity(b);
                 }
                 return;
             }
-
-            // Ignore collisions between player projectiles (laser beam vs normal shots)
-            if (isPlayerProj(tagA) && isPlayerProj(tagB)) {
-                return; // Don't process collision
-            }
-            
-            // Projectile vs projectile collision: player missiles pass through enemy missiles
-            if ((isPlayerProj(tagA) && isEnemyProj(tagB)) || (isPlayerProj(tagB) && isEnemyProj(tagA))) {
-                return; // No interaction between projectiles
-            }
         });
         // std::cout << "[PlayState] Collision callback registered" << std::endl;
     }
@@ -957,6 +974,20 @@ void PlayState::loadVFXConfig()
 
 eng::engine::rendering::ISprite* PlayState::loadSprite(const std::string& texturePath, const eng::engine::rendering::IntRect* rect)
 {
+    // Sprite sheets share atlas pages (one texture, batched draws); large images keep their own
+    eng::engine::rendering::sfml::SFMLTextureAtlas::Region region;
+    if (textureAtlas_.acquire(texturePath, region)) {
+        auto sprite = std::make_unique<eng::engine::rendering::sfml::SFMLSprite>();
+        sprite->setTexture(region.texture);
+        sprite->setAtlasRegion(region.rect);
+        if (rect && (rect->width != 0 || rect->height != 0)) {
+            sprite->setTextureRect(*rect);
+        }
+        eng::engine::rendering::ISprite* spritePtr = sprite.get();
+        loadedSprites_.push_back(std::move(sprite));
+        return spritePtr;
+    }
+
     // Create texture
     auto texture = std::make_unique<eng::engine::rendering::sfml::SFMLTexture>();
     if (!texture->loadFromFile(texturePath)) {
@@ -1050,13 +1081,14 @@ void PlayState::spawnPlayer()
     }
 
     // Create player entity
-    playerEntity_ = coordinator->CreateEntity();
+    const ECS::Entity player = coordinator->CreateEntity();
+    playerEntity_ = coordinator->GetHandle(player);
 
     // Position (left side, center vertically)
-    coordinator->AddComponent<Position>(playerEntity_, Position{100.0f, 400.0f});
+    coordinator->AddComponent<Position>(player, Position{100.0f, 400.0f});
 
     // Velocity (controlled by input)
-    coordinator->AddComponent<Velocity>(playerEntity_, Velocity{0.0f, 0.0f});
+    coordinator->AddComponent<Velocity>(player, Velocity{0.0f, 0.0f});
 
     // Sprite (player ship) - Using r-typesheet42.png
     // Frame layout: 5 frames (33x17 each): [Down2][Down1][Neutral][Up1][Up2]
@@ -1081,14 +1113,15 @@ void PlayState::spawnPlayer()
               // << playerSprite.textureRect.width << ", " 
               // << playerSprite.textureRect.height << "}" << std::endl;
     
-    coordinator->AddComponent<Sprite>(playerEntity_, playerSprite);
+    coordinator->AddComponent<Sprite>(player, playerSprite);
 
     // Collider (for collisions) - Use sprite dimensions with scale
     Collider playerCollider;
     playerCollider.width = playerSprite.textureRect.width * playerSprite.scaleX;
     playerCollider.height = playerSprite.textureRect.height * playerSprite.scaleY;
     playerCollider.isTrigger = false;
-    coordinator->AddComponent<Collider>(playerEntity_, playerCollider);
+    collisionLayers_.assign(playerCollider, "player");
+    coordinator->AddComponent<Collider>(player, playerCollider);
 
     // Health with shorter invincibility duration
     Health playerHealth;
@@ -1096,20 +1129,20 @@ void PlayState::spawnPlayer()
     playerHealth.max = playerMaxHealth_;
     playerHealth.invincibilityDuration = 0.8f;  // 0.8 seconds invulnerability after hit
     playerHealth.destroyOnDeath = false;  // Don't auto-destroy player on death
-    coordinator->AddComponent<Health>(playerEntity_, playerHealth);
+    coordinator->AddComponent<Health>(player, playerHealth);
 
     // Tag as player
-    coordinator->AddComponent<Tag>(playerEntity_, Tag{"player"});
+    coordinator->AddComponent<Tag>(player, Tag{"player"});
 
     // Score component
     Score playerScore;
     playerScore.current = 0;
     playerScore.highScore = loadHighScore(); // Load from file
-    coordinator->AddComponent<Score>(playerEntity_, playerScore);
+    coordinator->AddComponent<Score>(player, playerScore);
 
     // No Boundary component - we'll handle player boundaries manually in update()
     
-    // std::cout << "[PlayState] Player spawned (Entity ID: " << playerEntity_ << ")" << std::endl;
+    // std::cout << "[PlayState] Player spawned (Entity ID: " << player << ")" << std::endl;
 }
 
 void PlayState::spawnChargeIndicator()
@@ -1195,9 +1228,9 @@ void PlayState::updateChargeIndicator(float chargeTime)
     const float CHARGE_ANIMATION_DELAY = 0.15f;
 
     // Update position to follow player (FROM LUA CONFIG)
-    if (coordinator->HasComponent<Position>(playerEntity_) && 
+    if (coordinator->IsAlive(playerEntity_) && 
         coordinator->HasComponent<Position>(chargeIndicatorEntity_)) {
-        auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
+        auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
         auto& chargePos = coordinator->GetComponent<Position>(chargeIndicatorEntity_);
         
         // Position from Lua config
@@ -1303,17 +1336,16 @@ void PlayState::handleShooting()
     }
 
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || playerEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(playerEntity_)) return;
 
     // Get player position
-    if (!coordinator->HasComponent<Position>(playerEntity_)) return;
-    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
+    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
 
     // Reset cooldown
     timeSinceLastShot_ = 0.0f;
     
     // If a module is equipped, fire ONLY from the module!
-    if (equippedModuleEntity_ != 0 && equippedModuleType_ != "none") {
+    if (hasEquippedModule()) {
         // std::cout << "[PlayState]  Shooting with MODULE: " << equippedModuleType_ << std::endl;
         
         if (equippedModuleType_ == "spread") {
@@ -1415,11 +1447,8 @@ void PlayState::handleShooting()
     // Hauteur visuelle du sprite du missile (pour centrage vertical)
     float missileVisualH = static_cast<float>(textureRect.height) * spriteScale;
     // Hauteur visuelle du joueur (pour calculer son centre Y)
-    float playerVisualH = 34.0f * 2.0f; // frame 33px * scale ~2 (valeur approx)
-    if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_);
-        playerVisualH = playerSprite.textureRect.height * playerSprite.scaleY;
-    }
+    auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
+    float playerVisualH = playerSprite.textureRect.height * playerSprite.scaleY;
 
     // Position : en avant du joueur, missile centré sur le centre vertical du joueur
     float spawnX = playerPos.x + 50.0f;
@@ -1494,6 +1523,7 @@ void PlayState::handleShooting()
         }
         col.offsetX = 0.0f;
         col.offsetY = 0.0f;
+        collisionLayers_.assign(col, "player_projectile");
         coordinator->AddComponent<Collider>(projectile, col);
     }
 
@@ -1546,7 +1576,7 @@ void PlayState::update(float deltaTime)
     bool spaceCurrentlyPressed = eng::engine::Keyboard::isKeyPressed(eng::engine::Key::Space);
     
     // Module equipped → tir automatique en continu (pas de charge)
-    if (equippedModuleEntity_ != 0 && equippedModuleType_ != "none") {
+    if (hasEquippedModule()) {
         if (spaceCurrentlyPressed) {
             handleShooting(); // tirera dès que le cooldown est passé
         }
@@ -1588,8 +1618,8 @@ void PlayState::update(float deltaTime)
         // AFTER InputSystem updates: rescale player velocity to match Lua config
         // InputSystem uses hardcoded value, we need to apply playerSpeed_ from Lua
         auto coordinator = game_->getCoordinator();
-        if (coordinator && playerEntity_ != 0 && coordinator->HasComponent<Velocity>(playerEntity_)) {
-            auto& vel = coordinator->GetComponent<Velocity>(playerEntity_);
+        if (coordinator && coordinator->IsAlive(playerEntity_)) {
+            auto& vel = coordinator->GetComponent<Velocity>(playerEntity_.index);
             
             // Rescale from InputSystem speed to playerSpeed_ from Lua config
             if (vel.dx != 0.0f) {
@@ -1600,95 +1630,92 @@ void PlayState::update(float deltaTime)
             }
             
             // Animate player sprite based on vertical velocity
-            if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-                auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_);
-                
-                // Progressive animation with 5 frames based on vertical velocity
-                // r-typesheet42.png has 5 frames (33x17 each):
-                // Frame 0: {0,0,33,17} - Extreme Down
-                // Frame 1: {33,0,33,17} - Down
-                // Frame 2: {66,0,33,17} - Neutral (center)
-                // Frame 3: {99,0,33,17} - Up
-                // Frame 4: {132,0,33,17} - Extreme Up
+            auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
+            
+            // Progressive animation with 5 frames based on vertical velocity
+            // r-typesheet42.png has 5 frames (33x17 each):
+            // Frame 0: {0,0,33,17} - Extreme Down
+            // Frame 1: {33,0,33,17} - Down
+            // Frame 2: {66,0,33,17} - Neutral (center)
+            // Frame 3: {99,0,33,17} - Up
+            // Frame 4: {132,0,33,17} - Extreme Up
+            
+            // State tracking for progressive transitions
+            static float extremeUpTimer = 0.0f;
+            static float extremeDownTimer = 0.0f;
+            static int currentFrame = 2;  // Start at neutral
+            static float transitionTimer = 0.0f;
+            const float transitionDelay = 0.08f;
+            
+            if (vel.dy < -10.0f) {
+                // Moving up
+                extremeDownTimer = 0.0f;
+                extremeUpTimer += deltaTime;
                 
-                // State tracking for progressive transitions
-                static float extremeUpTimer = 0.0f;
-                static float extremeDownTimer = 0.0f;
-                static int currentFrame = 2;  // Start at neutral
-                static float transitionTimer = 0.0f;
-                const float transitionDelay = 0.08f;
+                if (extremeUpTimer > transitionDelay && currentFrame == 3) {
+                    // Transition from moderate up to extreme up
+                    currentFrame = 4;
+                    sprite.textureRect = {132, 0, 33, 17};
+                } else if (currentFrame < 3) {
+                    // Transition to moderate up
+                    currentFrame = 3;
+                    sprite.textureRect = {99, 0, 33, 17};
+                    extremeUpTimer = 0.0f;
+                }
+            } else if (vel.dy > 10.0f) {
+                // Moving down
+                extremeUpTimer = 0.0f;
+                extremeDownTimer += deltaTime;
                 
-                if (vel.dy < -10.0f) {
-                    // Moving up
+                if (extremeDownTimer > transitionDelay && currentFrame == 1) {
+                    // Transition from moderate down to extreme down
+                    currentFrame = 0;
+                    sprite.textureRect = {0, 0, 33, 17};
+                } else if (currentFrame > 1) {
+                    // Transition to moderate down
+                    currentFrame = 1;
+                    sprite.textureRect = {33, 0, 33, 17};
                     extremeDownTimer = 0.0f;
-                    extremeUpTimer += deltaTime;
-                    
-                    if (extremeUpTimer > transitionDelay && currentFrame == 3) {
-                        // Transition from moderate up to extreme up
-                        currentFrame = 4;
-                        sprite.textureRect = {132, 0, 33, 17};
-                    } else if (currentFrame < 3) {
-                        // Transition to moderate up
+                }
+            } else {
+                // Returning to neutral - progressive transition
+                extremeUpTimer = 0.0f;
+                extremeDownTimer = 0.0f;
+                transitionTimer += deltaTime;
+                
+                if (transitionTimer > transitionDelay * 0.5f) {
+                    if (currentFrame == 4) {
+                        // From extreme up to moderate up
                         currentFrame = 3;
                         sprite.textureRect = {99, 0, 33, 17};
-                        extremeUpTimer = 0.0f;
-                    }
-                } else if (vel.dy > 10.0f) {
-                    // Moving down
-                    extremeUpTimer = 0.0f;
-                    extremeDownTimer += deltaTime;
-                    
-                    if (extremeDownTimer > transitionDelay && currentFrame == 1) {
-                        // Transition from moderate down to extreme down
-                        currentFrame = 0;
-                        sprite.textureRect = {0, 0, 33, 17};
-                    } else if (currentFrame > 1) {
-                        // Transition to moderate down
+                        transitionTimer = 0.0f;
+                    } else if (currentFrame == 0) {
+                        // From extreme down to moderate down
                         currentFrame = 1;
                         sprite.textureRect = {33, 0, 33, 17};
-                        extremeDownTimer = 0.0f;
-                    }
-                } else {
-                    // Returning to neutral - progressive transition
-                    extremeUpTimer = 0.0f;
-                    extremeDownTimer = 0.0f;
-                    transitionTimer += deltaTime;
-                    
-                    if (transitionTimer > transitionDelay * 0.5f) {
-                        if (currentFrame == 4) {
-                            // From extreme up to moderate up
-                            currentFrame = 3;
-                            sprite.textureRect = {99, 0, 33, 17};
-                            transitionTimer = 0.0f;
-                        } else if (currentFrame == 0) {
-                            // From extreme down to moderate down
-                            currentFrame = 1;
-                            sprite.textureRect = {33, 0, 33, 17};
-                            transitionTimer = 0.0f;
-                        } else if (currentFrame == 3 || currentFrame == 1) {
-                            // From moderate to neutral
-                            currentFrame = 2;
-                            sprite.textureRect = {66, 0, 33, 17};
-                            transitionTimer = 0.0f;
-                        }
+                        transitionTimer = 0.0f;
+                    } else if (currentFrame == 3 || currentFrame == 1) {
+                        // From moderate to neutral
+                        currentFrame = 2;
+                        sprite.textureRect = {66, 0, 33, 17};
+                        transitionTimer = 0.0f;
                     }
                 }
-                
-                // Apply the new textureRect to the SFML sprite
-                if (sprite.sprite) {
-                    sprite.sprite->setTextureRect(sprite.textureRect);
-                }
+            }
+            
+            // Apply the new textureRect to the SFML sprite
+            if (sprite.sprite) {
+                sprite.sprite->setTextureRect(sprite.textureRect);
             }
         }
     }
-    if (scrollingSystem_) scrollingSystem_->Update(deltaTime);
     if (movementSystem_) movementSystem_->Update(deltaTime);
     
     // Manual player boundary check (keep player fully visible on screen)
     auto coordinator = game_->getCoordinator();
-    if (coordinator && coordinator->HasComponent<Position>(playerEntity_) && coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& pos = coordinator->GetComponent<Position>(playerEntity_);
-        auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_);
+    if (coordinator && coordinator->IsAlive(playerEntity_)) {
+        auto& pos = coordinator->GetComponent<Position>(playerEntity_.index);
+        auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
         
         float playerWidth = sprite.textureRect.width * sprite.scaleX;
         float playerHeight = sprite.textureRect.height * sprite.scaleY;
@@ -1705,21 +1732,20 @@ void PlayState::update(float deltaTime)
         }
         
         // Cancel velocity if at boundary
-        if (coordinator->HasComponent<Velocity>(playerEntity_)) {
-            auto& vel = coordinator->GetComponent<Velocity>(playerEntity_);
-            if (pos.x <= margin && vel.dx < 0) vel.dx = 0.0f;
-            if (pos.y <= margin && vel.dy < 0) vel.dy = 0.0f;
-            if (pos.x + playerWidth >= windowWidth_ - margin && vel.dx > 0) vel.dx = 0.0f;
-            if (pos.y + playerHeight >= windowHeight_ - bottomMargin && vel.dy > 0) {
-                vel.dy = 0.0f;
-            }
+        auto& vel = coordinator->GetComponent<Velocity>(playerEntity_.index);
+        if (pos.x <= margin && vel.dx < 0) vel.dx = 0.0f;
+        if (pos.y <= margin && vel.dy < 0) vel.dy = 0.0f;
+        if (pos.x + playerWidth >= windowWidth_ - margin && vel.dx > 0) vel.dx = 0.0f;
+        if (pos.y + playerHeight >= windowHeight_ - bottomMargin && vel.dy > 0) {
+            vel.dy = 0.0f;
         }
     }
     
     if (boundarySystem_) boundarySystem_->Update(deltaTime);  // For projectiles and enemies
-    if (lifetimeSystem_) lifetimeSystem_->Update(deltaTime);  // Destroy expired entities
-    if (animationSystem_) animationSystem_->Update(deltaTime);
+    // Background scrolling, lifetimes (expired entities destroyed at the end) and animations
+    if (systemScheduler_) systemScheduler_->Run(deltaTime);
     if (collisionSystem_) collisionSystem_->Update(deltaTime);
+    collisionCommands_.Flush();  // Apply collision kills/explosions in one batch
     
     // Update wave projectile motion
     updateWaveProjectiles(deltaTime);
@@ -1731,11 +1757,13 @@ void PlayState::update(float deltaTime)
     updateLaserBeam(deltaTime);
     
     // Update invulnerability timers and flashing effect
-    // Only check player + active enemies (not all 5000 entity slots)
+    // Only check player + active enemies (not every entity slot)
     if (coordinator) {
         std::vector<ECS::Entity> entitiesToCheck;
-        if (playerEntity_ != 0) entitiesToCheck.push_back(playerEntity_);
-        for (auto e : activeEnemies_) entitiesToCheck.push_back(e);
+        if (coordinator->IsAlive(playerEntity_)) entitiesToCheck.push_back(playerEntity_.index);
+        for (auto e : activeEnemies_) {
+            if (coordinator->IsAlive(e)) entitiesToCheck.push_back(e.index);
+        }
         
         for (ECS::Entity entity : entitiesToCheck) {
             if (!coordinator->HasComponent<Health>(entity)) continue;
@@ -1812,13 +1840,11 @@ void PlayState::update(float deltaTime)
     }
 
     // Check player death → Game Over
-    if (!gameOverTriggered_ && playerEntity_ != 0 &&
-        coordinator && coordinator->HasComponent<Health>(playerEntity_)) {
-        auto& ph = coordinator->GetComponent<Health>(playerEntity_);
+    if (!gameOverTriggered_ && coordinator && coordinator->IsAlive(playerEntity_)) {
+        auto& ph = coordinator->GetComponent<Health>(playerEntity_.index);
         if (ph.current <= 0) {
             gameOverTriggered_ = true;
-            int finalScore = coordinator->HasComponent<Score>(playerEntity_)
-                ? coordinator->GetComponent<Score>(playerEntity_).current : 0;
+            int finalScore = coordinator->GetComponent<Score>(playerEntity_.index).current;
             game_->getStateManager()->pushState(
                 std::make_unique<GameOverState>(game_, finalScore));
             return;
@@ -1837,37 +1863,35 @@ void PlayState::render()
     auto* renderer = game_->getRenderer();
     
     // Draw UI: Health bar and Score
-    if (coordinator && renderer && playerEntity_ != 0) {
+    if (coordinator && renderer && coordinator->IsAlive(playerEntity_)) {
         // Draw health bar
-        if (coordinator->HasComponent<Health>(playerEntity_)) {
-            auto& health = coordinator->GetComponent<Health>(playerEntity_);
-            float healthPercent = static_cast<float>(health.current) / static_cast<float>(health.max);
-            
-            // Health bar background (dark red)
-            eng::engine::rendering::FloatRect healthBg;
-            healthBg.left = 20.0f;
-            healthBg.top = 20.0f;
-            healthBg.width = 200.0f;
-            healthBg.height = 20.0f;
-            renderer->drawRect(healthBg, 0x800000FF, 0xFFFFFFFF, 2.0f);
-            
-            // Health bar foreground (green/yellow/red based on percentage)
-            eng::engine::rendering::FloatRect healthFg;
-            healthFg.left = 22.0f;
-            healthFg.top = 22.0f;
-            healthFg.width = (200.0f - 4.0f) * healthPercent;
-            healthFg.height = 16.0f;
-            
-            uint32_t healthColor = 0x00FF00FF; // Green
-            if (healthPercent < 0.5f) healthColor = 0xFFFF00FF; // Yellow
-            if (healthPercent < 0.25f) healthColor = 0xFF0000FF; // Red
-            
-            renderer->drawRect(healthFg, healthColor, healthColor, 0.0f);
-        }
+        auto& health = coordinator->GetComponent<Health>(playerEntity_.index);
+        float healthPercent = static_cast<float>(health.current) / static_cast<float>(health.max);
+        
+        // Health bar background (dark red)
+        eng::engine::rendering::FloatRect healthBg;
+        healthBg.left = 20.0f;
+        healthBg.top = 20.0f;
+        healthBg.width = 200.0f;
+        healthBg.height = 20.0f;
+        renderer->drawRect(healthBg, 0x800000FF, 0xFFFFFFFF, 2.0f);
+        
+        // Health bar foreground (green/yellow/red based on percentage)
+        eng::engine::rendering::FloatRect healthFg;
+        healthFg.left = 22.0f;
+        healthFg.top = 22.0f;
+        healthFg.width = (200.0f - 4.0f) * healthPercent;
+        healthFg.height = 16.0f;
+        
+        uint32_t healthColor = 0x00FF00FF; // Green
+        if (healthPercent < 0.5f) healthColor = 0xFFFF00FF; // Yellow
+        if (healthPercent < 0.25f) healthColor = 0xFF0000FF; // Red
+        
+        renderer->drawRect(healthFg, healthColor, healthColor, 0.0f);
         
         // Update and draw score
-        if (scoreText_ && coordinator->HasComponent<Score>(playerEntity_)) {
-            auto& score = coordinator->GetComponent<Score>(playerEntity_);
+        if (scoreText_) {
+            auto& score = coordinator->GetComponent<Score>(playerEntity_.index);
             scoreText_->setString("Score: " + std::to_string(score.current));
             renderer->drawText(*scoreText_);
         }
@@ -1936,17 +1960,12 @@ void PlayState::render()
     }
     
     // Draw shield around player if active
-    if (coordinator && renderer && shieldActive_ && playerEntity_ != 0 &&
-        coordinator->HasComponent<Position>(playerEntity_)) {
-        auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
+    if (coordinator && renderer && shieldActive_ && coordinator->IsAlive(playerEntity_)) {
+        auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
         
-        float playerWidth = 66.0f;
-        float playerHeight = 34.0f;
-        if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-            auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_);
-            playerWidth  = sprite.textureRect.width  * sprite.scaleX;
-            playerHeight = sprite.textureRect.height * sprite.scaleY;
-        }
+        auto& sprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
+        float playerWidth  = sprite.textureRect.width  * sprite.scaleX;
+        float playerHeight = sprite.textureRect.height * sprite.scaleY;
         
         float shieldRadius = std::max(playerWidth, playerHeight) * 0.8f;
         const int segments = 8;
@@ -1979,8 +1998,8 @@ void PlayState::render()
     // Draw charge indicator if charging
     if (isCharging_ && chargeTime_ > 0.0f) {
         auto coordinator = game_->getCoordinator();
-        if (coordinator && coordinator->HasComponent<Position>(playerEntity_)) {
-            auto& pos = coordinator->GetComponent<Position>(playerEntity_);
+        if (coordinator && coordinator->IsAlive(playerEntity_)) {
+            auto& pos = coordinator->GetComponent<Position>(playerEntity_.index);
             
             // Calculate charge level and progress
             int chargeLevel = calculateChargeLevel();
@@ -2181,15 +2200,11 @@ void PlayState::spawnModule(float x, float y, const std::string& moduleType)
 void PlayState::checkCollectableCollisions()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || playerEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(playerEntity_)) return;
     
     // Get player position and size for collision check
-    if (!coordinator->HasComponent<Position>(playerEntity_) || !coordinator->HasComponent<Sprite>(playerEntity_)) {
-        return;
-    }
-    
-    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
-    auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_);
+    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
+    auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
     
     float playerWidth = playerSprite.textureRect.width * playerSprite.scaleX;
     float playerHeight = playerSprite.textureRect.height * playerSprite.scaleY;
@@ -2249,11 +2264,12 @@ void PlayState::pickupPowerup(ECS::Entity powerupEntity, const std::string& type
         // std::cout << "[PlayState]  BOMB! Destroying all enemies on screen!" << std::endl;
         
         // Destroy all active enemies that are VISIBLE on screen
-        std::vector<ECS::Entity> enemiesToDestroy = activeEnemies_; // Copy to avoid iterator invalidation
+        std::vector<ECS::EntityHandle> enemiesToDestroy = activeEnemies_; // Copy to avoid iterator invalidation
         int destroyedCount = 0;
         
-        for (auto enemy : enemiesToDestroy) {
-            if (!coordinator->HasComponent<Position>(enemy)) continue;
+        for (const auto& handle : enemiesToDestroy) {
+            if (!coordinator->IsAlive(handle)) continue;
+            const ECS::Entity enemy = handle.index;
             
             // Get enemy position
             auto& pos = coordinator->GetComponent<Position>(enemy);
@@ -2351,16 +2367,7 @@ void PlayState::pickupPowerup(ECS::Entity powerupEntity, const std::string& type
             
             // Destroy the enemy
             coordinator->DestroyEntity(enemy);
-            
-            // Remove from activeEnemies_
-            auto it = std::find(activeEnemies_.begin(), activeEnemies_.end(), enemy);
-            if (it != activeEnemies_.end()) {
-                activeEnemies_.erase(it);
-            }
-            
-            // Remove from fire patterns map and kamikaze set
-            enemyFirePatterns_.erase(enemy);
-            kamikazeEntities_.erase(enemy);
+            untrackEnemy(enemy);
         }
         
         // std::cout << "[PlayState]  Destroyed " << destroyedCount << " visible enemies (out of " 
@@ -2390,7 +2397,7 @@ void PlayState::attachModule(ECS::Entity moduleEntity, const std::string& module
     }
     
     // If already have a module equipped, destroy the old one
-    if (equippedModuleEntity_ != 0) {
+    if (coordinator->IsAlive(equippedModuleEntity_)) {
         // std::cout << "[PlayState] Replacing old module: " << equippedModuleType_ << std::endl;
         coordinator->DestroyEntity(equippedModuleEntity_);
     }
@@ -2415,20 +2422,36 @@ void PlayState::attachModule(ECS::Entity moduleEntity, const std::string& module
     }
     
     // Store equipped module
-    equippedModuleEntity_ = moduleEntity;
+    equippedModuleEntity_ = coordinator->GetHandle(moduleEntity);
     equippedModuleType_ = extractedType;
     
     // std::cout << "[PlayState]  Module attached: " << equippedModuleType_ << std::endl;
 }
 
+bool PlayState::hasEquippedModule()
+{
+    auto coordinator = game_->getCoordinator();
+    return coordinator && coordinator->IsAlive(equippedModuleEntity_) && equippedModuleType_ != "none";
+}
+
+void PlayState::untrackEnemy(ECS::Entity enemy)
+{
+    activeEnemies_.erase(
+        std::remove_if(activeEnemies_.begin(), activeEnemies_.end(),
+            [enemy](const ECS::EntityHandle& handle) { return handle.index == enemy; }),
+        activeEnemies_.end());
+    enemyFirePatterns_.erase(enemy);
+    kamikazeEntities_.erase(enemy);
+}
+
 void PlayState::startLaserBeam()
 {
     // std::cout << "[PlayState] startLaserBeam() called" << std::endl;
     
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || equippedModuleEntity_ == 0 || equippedModuleType_ != "laser") {
+    if (!coordinator || !coordinator->IsAlive(equippedModuleEntity_) || equippedModuleType_ != "laser") {
         // std::cout << "[PlayState]  Cannot start laser: coordinator=" << (coordinator ? "OK" : "NULL") 
-        //           << ", moduleEntity=" << equippedModuleEntity_ 
+        //           << ", moduleEntity=" << equippedModuleEntity_.index 
         //           << ", moduleType=" << equippedModuleType_ << std::endl;
         return;
     }
@@ -2440,8 +2463,8 @@ void PlayState::startLaserBeam()
     }
 
     // Position du module
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
-    auto& moduleSprite = coordinator->GetComponent<Sprite>(equippedModuleEntity_);
+    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
+    auto& moduleSprite = coordinator->GetComponent<Sprite>(equippedModuleEntity_.index);
 
     // Créer l'entité du laser
     laserBeamEntity_ = coordinator->CreateEntity();
@@ -2476,6 +2499,7 @@ void PlayState::startLaserBeam()
     Collider beamCollider;
     beamCollider.width = 2000.0f;
     beamCollider.height = 30.0f;
+    collisionLayers_.assign(beamCollider, "player_projectile");
     coordinator->AddComponent(laserBeamEntity_, beamCollider);
 
     // Tag pour le routing des collisions
@@ -2508,30 +2532,28 @@ void PlayState::stopLaserBeam()
 
 void PlayState::updateLaserBeam(float /* deltaTime */)
 {
-    if (laserBeamEntity_ == 0 || equippedModuleEntity_ == 0) {
+    auto coordinator = game_->getCoordinator();
+    if (!coordinator || laserBeamEntity_ == 0 || equippedModuleEntity_.IsNull()) {
         return;
     }
 
-    auto coordinator = game_->getCoordinator();
-    if (!coordinator) return;
-
     // Check if laser beam still exists
     if (!coordinator->HasComponent<Position>(laserBeamEntity_)) {
         laserBeamEntity_ = 0;
         return;
     }
 
-    // Check if module still exists
-    if (!coordinator->HasComponent<Position>(equippedModuleEntity_)) {
-        equippedModuleEntity_ = 0;
+    // Module destroyed while the beam was active
+    if (!coordinator->IsAlive(equippedModuleEntity_)) {
+        equippedModuleEntity_ = {};
         equippedModuleType_ = "none";
         laserBeamEntity_ = 0;
         return;
     }
 
     // Récupérer la position du module
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
-    auto& moduleSprite = coordinator->GetComponent<Sprite>(equippedModuleEntity_);
+    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
+    auto& moduleSprite = coordinator->GetComponent<Sprite>(equippedModuleEntity_.index);
 
     // Mettre à jour la position du laser pour qu'il suive le module
     auto& beamPos = coordinator->GetComponent<Position>(laserBeamEntity_);
@@ -2542,28 +2564,24 @@ void PlayState::updateLaserBeam(float /* deltaTime */)
 void PlayState::updateAttachedModule()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || equippedModuleEntity_ == 0 || playerEntity_ == 0) return;
+    if (!coordinator || equippedModuleEntity_.IsNull() || !coordinator->IsAlive(playerEntity_)) return;
     
     // Check if module still exists
-    if (!coordinator->HasComponent<Position>(equippedModuleEntity_)) {
-        equippedModuleEntity_ = 0;
+    if (!coordinator->IsAlive(equippedModuleEntity_)) {
+        equippedModuleEntity_ = {};
         equippedModuleType_ = "none";
         return;
     }
     
     // Get player position
-    if (!coordinator->HasComponent<Position>(playerEntity_)) return;
-    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
+    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
     
     // Get player sprite to calculate proper offset
-    float playerWidth = 33.0f;  // Default player width
-    if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_);
-        playerWidth = playerSprite.textureRect.width * playerSprite.scaleX;
-    }
+    auto& playerSprite = coordinator->GetComponent<Sprite>(playerEntity_.index);
+    float playerWidth = playerSprite.textureRect.width * playerSprite.scaleX;
     
     // Update module position to follow player (attach in front of player)
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
+    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
     modulePos.x = playerPos.x + playerWidth;  // In front of player
     modulePos.y = playerPos.y + 5.0f;  // Slightly below center
 }
@@ -2575,11 +2593,10 @@ void PlayState::updateAttachedModule()
 void PlayState::fireSpreadModule()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || equippedModuleEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(equippedModuleEntity_)) return;
     
-    // Get module position (where to spawn projectiles from)
-    if (!coordinator->HasComponent<Position>(equippedModuleEntity_)) return;
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
+    // Get module position (where to spawn projectiles from), copied: spawning adds Positions
+    const Position modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
     
     // std::cout << "[PlayState]  Firing SPREAD module!" << std::endl;
     
@@ -2614,13 +2631,13 @@ void PlayState::fireSpreadModule()
     // Calcul du spawn Y centré sur le joueur (comme le missile normal)
     float missileVisualH_s = static_cast<float>(textureRect.height) * spriteScale;
     float playerVisualH_s  = 34.0f * 2.0f;
-    if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_);
+    if (coordinator->IsAlive(playerEntity_)) {
+        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_.index);
         playerVisualH_s = ps.textureRect.height * ps.scaleY;
     }
     float playerPosY_s = modulePos.y;
-    if (coordinator->HasComponent<Position>(playerEntity_)) {
-        playerPosY_s = coordinator->GetComponent<Position>(playerEntity_).y;
+    if (coordinator->IsAlive(playerEntity_)) {
+        playerPosY_s = coordinator->GetComponent<Position>(playerEntity_.index).y;
     }
     float spawnY_s = playerPosY_s + (playerVisualH_s / 2.0f) - (missileVisualH_s / 2.0f);
 
@@ -2658,6 +2675,7 @@ void PlayState::fireSpreadModule()
             col.height  = 22.0f;
             col.offsetX = 0.0f;
             col.offsetY = 14.0f;
+            collisionLayers_.assign(col, "player_projectile");
             coordinator->AddComponent<Collider>(projectile, col);
         }
         
@@ -2688,11 +2706,10 @@ void PlayState::fireSpreadModule()
 void PlayState::fireWaveModule()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || equippedModuleEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(equippedModuleEntity_)) return;
     
-    // Get module position (where to spawn projectiles from)
-    if (!coordinator->HasComponent<Position>(equippedModuleEntity_)) return;
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
+    // Get module position (where to spawn projectiles from), copied: spawning adds Positions
+    const Position modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
     
     // std::cout << "[PlayState]  Firing WAVE module!" << std::endl;
     
@@ -2723,13 +2740,13 @@ void PlayState::fireWaveModule()
     // Calcul du spawn Y centré sur le joueur (comme le missile normal)
     float missileVisualH_w = static_cast<float>(textureRect.height) * spriteScale;
     float playerVisualH_w  = 34.0f * 2.0f;
-    if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_);
+    if (coordinator->IsAlive(playerEntity_)) {
+        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_.index);
         playerVisualH_w = ps.textureRect.height * ps.scaleY;
     }
     float playerPosY_w = modulePos.y;
-    if (coordinator->HasComponent<Position>(playerEntity_)) {
-        playerPosY_w = coordinator->GetComponent<Position>(playerEntity_).y;
+    if (coordinator->IsAlive(playerEntity_)) {
+        playerPosY_w = coordinator->GetComponent<Position>(playerEntity_.index).y;
     }
     float spawnY_w = playerPosY_w + (playerVisualH_w / 2.0f) - (missileVisualH_w / 2.0f);
 
@@ -2771,6 +2788,7 @@ void PlayState::fireWaveModule()
         col.height  = 22.0f;
         col.offsetX = 0.0f;
         col.offsetY = 14.0f;
+        collisionLayers_.assign(col, "player_projectile");
         coordinator->AddComponent<Collider>(projectile, col);
     }
     
@@ -2803,13 +2821,10 @@ void PlayState::updateWaveProjectiles(float deltaTime)
     
     // Collect wave entities first to avoid iterator invalidation
     std::vector<ECS::Entity> waveEntities;
-    for (ECS::Entity entity = 1; entity < 5000; ++entity) {
-        if (coordinator->HasComponent<WaveMotion>(entity) &&
-            coordinator->HasComponent<Position>(entity) &&
-            coordinator->HasComponent<Velocity>(entity)) {
+    coordinator->View<WaveMotion, Position, Velocity>().Each(
+        [&waveEntities](ECS::Entity entity, WaveMotion&, Position&, Velocity&) {
             waveEntities.push_back(entity);
-        }
-    }
+        });
     
     for (auto entity : waveEntities) {
         auto& waveMotion = coordinator->GetComponent<WaveMotion>(entity);
@@ -2828,11 +2843,10 @@ void PlayState::updateWaveProjectiles(float deltaTime)
 void PlayState::fireHomingModule()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || equippedModuleEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(equippedModuleEntity_)) return;
     
-    // Get module position (where to spawn projectiles from)
-    if (!coordinator->HasComponent<Position>(equippedModuleEntity_)) return;
-    auto& modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_);
+    // Get module position (where to spawn projectiles from), copied: spawning adds Positions
+    const Position modulePos = coordinator->GetComponent<Position>(equippedModuleEntity_.index);
     
     // std::cout << "[PlayState]  Firing HOMING module!" << std::endl;
     
@@ -2863,13 +2877,13 @@ void PlayState::fireHomingModule()
     // Calcul du spawn Y centré sur le joueur (comme le missile normal)
     float missileVisualH_h = static_cast<float>(textureRect.height) * spriteScale;
     float playerVisualH_h  = 34.0f * 2.0f;
-    if (coordinator->HasComponent<Sprite>(playerEntity_)) {
-        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_);
+    if (coordinator->IsAlive(playerEntity_)) {
+        auto& ps = coordinator->GetComponent<Sprite>(playerEntity_.index);
         playerVisualH_h = ps.textureRect.height * ps.scaleY;
     }
     float playerPosY_h = modulePos.y;
-    if (coordinator->HasComponent<Position>(playerEntity_)) {
-        playerPosY_h = coordinator->GetComponent<Position>(playerEntity_).y;
+    if (coordinator->IsAlive(playerEntity_)) {
+        playerPosY_h = coordinator->GetComponent<Position>(playerEntity_.index).y;
     }
     float spawnY_h = playerPosY_h + (playerVisualH_h / 2.0f) - (missileVisualH_h / 2.0f);
 
@@ -2910,6 +2924,7 @@ void PlayState::fireHomingModule()
         col.height  = 22.0f;
         col.offsetX = 0.0f;
         col.offsetY = 14.0f;
+        collisionLayers_.assign(col, "player_projectile");
         coordinator->AddComponent<Collider>(projectile, col);
     }
     
@@ -2942,13 +2957,10 @@ void PlayState::updateHomingProjectiles(float deltaTime)
     
     // Collect all homing projectiles
     std::vector<ECS::Entity> homingEntities;
-    for (ECS::Entity entity = 1; entity < 5000; ++entity) {
-        if (coordinator->HasComponent<Homing>(entity) &&
-            coordinator->HasComponent<Position>(entity) &&
-            coordinator->HasComponent<Velocity>(entity)) {
+    coordinator->View<Homing, Position, Velocity>().Each(
+        [&homingEntities](ECS::Entity entity, Homing&, Position&, Velocity&) {
             homingEntities.push_back(entity);
-        }
-    }
+        });
     
     for (auto entity : homingEntities) {
         auto& homing   = coordinator->GetComponent<Homing>(entity);
@@ -2959,8 +2971,9 @@ void PlayState::updateHomingProjectiles(float deltaTime)
         ECS::Entity nearestEnemy = 0;
         float nearestDistance = homing.detectionRadius;
         
-        for (ECS::Entity targetEntity : activeEnemies_) {
-            if (!coordinator->HasComponent<Position>(targetEntity)) continue;
+        for (const auto& target : activeEnemies_) {
+            if (!coordinator->IsAlive(target)) continue;
+            const ECS::Entity targetEntity = target.index;
             
             auto& targetPos = coordinator->GetComponent<Position>(targetEntity);
             float dx = targetPos.x - position.x;
@@ -3124,6 +3137,7 @@ void PlayState::spawnEnemy(const std::string& enemyType, float x, float y)
         // Apply scale from sprite config
         collider.width = baseWidth * enemySprite.scaleX;
         collider.height = baseHeight * enemySprite.scaleY;
+        collisionLayers_.assign(collider, "enemy");
         coordinator->AddComponent<Collider>(enemy, collider);
         
         // Tag as enemy
@@ -3161,7 +3175,7 @@ void PlayState::spawnEnemy(const std::string& enemyType, float x, float y)
         // std::cout << "[PlayState]  Spawned enemy: " << enemyType << " at (" << x << ", " << y << ")" << std::endl;
         
         // Add to active enemies list for optimized iteration
-        activeEnemies_.push_back(enemy);
+        activeEnemies_.push_back(coordinator->GetHandle(enemy));
         
         // Mark kamikaze enemies for homing movement
         std::string movType = movementData["type"].get_or<std::string>("straight");
@@ -3199,8 +3213,9 @@ void PlayState::updateEnemyMovement(float deltaTime)
     static std::unordered_map<ECS::Entity, float> zigzagTimers;
     
     // Iterate only over active enemies (optimized)
-    for (auto entity : activeEnemies_) {
-        if (!coordinator->HasComponent<Position>(entity)) continue;
+    for (const auto& handle : activeEnemies_) {
+        if (!coordinator->IsAlive(handle)) continue;
+        const ECS::Entity entity = handle.index;
         if (!coordinator->HasComponent<Velocity>(entity)) continue;
         
         auto& pos = coordinator->GetComponent<Position>(entity);
@@ -3230,29 +3245,29 @@ void PlayState::updateEnemyMovement(float deltaTime)
         }
         
         // KAMIKAZE pattern: always track the player using the dedicated set
-        if (kamikazeEntities_.find(entity) != kamikazeEntities_.end() && playerEntity_ != 0) {
-            if (coordinator->HasComponent<Position>(playerEntity_)) {
-                auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
-                
-                // Calculate direction to player
-                float dirX = playerPos.x - pos.x;
-                float dirY = playerPos.y - pos.y;
-                float distance = std::sqrt(dirX * dirX + dirY * dirY);
-                
-                if (distance > 0.0f) {
-                    // Keep constant speed, always aim at player
-                    float speed = std::sqrt(vel.dx * vel.dx + vel.dy * vel.dy);
-                    if (speed < 1.0f) speed = 500.0f; // Fallback if velocity got zeroed
-                    vel.dx = (dirX / distance) * speed;
-                    vel.dy = (dirY / distance) * speed;
-                }
+        if (kamikazeEntities_.find(entity) != kamikazeEntities_.end() && coordinator->IsAlive(playerEntity_)) {
+            auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
+            
+            // Calculate direction to player
+            float dirX = playerPos.x - pos.x;
+            float dirY = playerPos.y - pos.y;
+            float distance = std::sqrt(dirX * dirX + dirY * dirY);
+            
+            if (distance > 0.0f) {
+                // Keep constant speed, always aim at player
+                float speed = std::sqrt(vel.dx * vel.dx + vel.dy * vel.dy);
+                if (speed < 1.0f) speed = 500.0f; // Fallback if velocity got zeroed
+                vel.dx = (dirX / distance) * speed;
+                vel.dy = (dirY / distance) * speed;
             }
         }
     }
     
     // Clean up timers for destroyed enemies
     for (auto it = zigzagTimers.begin(); it != zigzagTimers.end(); ) {
-        if (std::find(activeEnemies_.begin(), activeEnemies_.end(), it->first) == activeEnemies_.end()) {
+        const ECS::Entity timed = it->first;
+        if (std::none_of(activeEnemies_.begin(), activeEnemies_.end(),
+                [timed](const ECS::EntityHandle& handle) { return handle.index == timed; })) {
             it = zigzagTimers.erase(it);
         } else {
             ++it;
@@ -3309,6 +3324,7 @@ void PlayState::spawnEnemyProjectile(const Position& pos, float dx, float dy, in
     Collider projCol;
     projCol.width = 13 * 2.0f;
     projCol.height = 8 * 2.0f;
+    collisionLayers_.assign(projCol, "enemy_projectile");
     coordinator->AddComponent(projectile, projCol);
     
     // Boundary (destroy when off screen)
@@ -3331,12 +3347,13 @@ void PlayState::updateEnemyFiring(float deltaTime)
     if (!coordinator) return;
     
     // Iterate only over active enemies (optimized)
-    for (auto entity : activeEnemies_) {
+    for (const auto& handle : activeEnemies_) {
+        if (!coordinator->IsAlive(handle)) continue;
+        const ECS::Entity entity = handle.index;
         if (!coordinator->HasComponent<Weapon>(entity)) continue;
-        if (!coordinator->HasComponent<Position>(entity)) continue;
         
         auto& weapon = coordinator->GetComponent<Weapon>(entity);
-        auto& pos = coordinator->GetComponent<Position>(entity);
+        const Position pos = coordinator->GetComponent<Position>(entity);  // Copied: spawning adds Positions
         
         // Update fire cooldown
         weapon.timeSinceLastFire += deltaTime;
@@ -3358,8 +3375,8 @@ void PlayState::updateEnemyFiring(float deltaTime)
                 
             } else if (firePattern == "aimed") {
                 // Shoot towards player
-                if (playerEntity_ != 0 && coordinator->HasComponent<Position>(playerEntity_)) {
-                    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_);
+                if (coordinator->IsAlive(playerEntity_)) {
+                    auto& playerPos = coordinator->GetComponent<Position>(playerEntity_.index);
                     float dx = playerPos.x - pos.x;
                     float dy = playerPos.y - pos.y;
                     spawnEnemyProjectile(pos, dx, dy, weapon.projectileDamage, weapon.projectileSpeed);
@@ -3410,7 +3427,7 @@ void PlayState::checkProjectileEnemyCollisions()
 void PlayState::checkPlayerEnemyCollisions()
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || playerEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(playerEntity_)) return;
     
     // TODO: Implement collision between player and enemies/enemy bullets
     // Check collision with entities tagged "enemy" or "enemy_bullet"
@@ -3445,17 +3462,15 @@ void PlayState::saveHighScore(uint32_t score)
 void PlayState::addScore(uint32_t points)
 {
     auto coordinator = game_->getCoordinator();
-    if (!coordinator || playerEntity_ == 0) return;
+    if (!coordinator || !coordinator->IsAlive(playerEntity_)) return;
     
-    if (coordinator->HasComponent<Score>(playerEntity_)) {
-        auto& score = coordinator->GetComponent<Score>(playerEntity_);
-        score.addPoints(points);
-        
-        // Save if new highscore
-        if (score.current > score.highScore) {
-            score.highScore = score.current;
-            saveHighScore(score.highScore);
-        }
+    auto& score = coordinator->GetComponent<Score>(playerEntity_.index);
+    score.addPoints(points);
+    
+    // Save if new highscore
+    if (score.current > score.highScore) {
+        score.highScore = score.current;
+        saveHighScore(score.highScore);
     }
 }
 
@@ -3479,10 +3494,8 @@ void PlayState::startLevel(int level) {
     // Clean up all remaining enemies from previous level
     auto coordinator = game_->getCoordinator();
     if (coordinator) {
-        for (auto enemy : activeEnemies_) {
-            if (coordinator->HasComponent<Tag>(enemy)) {
-                coordinator->DestroyEntity(enemy);
-            }
+        for (const auto& enemy : activeEnemies_) {
+            coordinator->DestroyEntity(enemy);  // No-op for enemies already gone
         }
         activeEnemies_.clear();
         
@@ -3540,11 +3553,11 @@ void PlayState::updateLevelSystem(float deltaTime) {
         // Clean dead enemies from activeEnemies_ list
         activeEnemies_.erase(
             std::remove_if(activeEnemies_.begin(), activeEnemies_.end(),
-                [&](ECS::Entity e) {
-                    bool dead = !coordinator->HasComponent<Tag>(e);
+                [&](const ECS::EntityHandle& e) {
+                    bool dead = !coordinator->IsAlive(e);
                     if (dead) {
-                        kamikazeEntities_.erase(e);
-                        enemyFirePatterns_.erase(e);
+                        kamikazeEntities_.erase(e.index);
+                        enemyFirePatterns_.erase(e.index);
                     }
                     return dead;
                 }),
@@ -3564,8 +3577,8 @@ void PlayState::updateLevelSystem(float deltaTime) {
                 // Small delay before next level starts
                 startLevel(currentLevel_);
             } else {
-                int finalScore = (coordinator && coordinator->HasComponent<Score>(playerEntity_))
-                    ? coordinator->GetComponent<Score>(playerEntity_).current : 0;
+                int finalScore = (coordinator && coordinator->IsAlive(playerEntity_))
+                    ? coordinator->GetComponent<Score>(playerEntity_.index).current : 0;
                 game_->getStateManager()->pushState(
                     std::make_unique<VictoryState>(game_, finalScore, currentLevel_));
                 levelActive_ = false;
@@ -3576,19 +3589,16 @@ void PlayState::updateLevelSystem(float deltaTime) {
             if (bossHealth.current <= 0) {
                 bossAlive_ = false;
                 coordinator->DestroyEntity(bossEntity_);
-                // Remove from activeEnemies_ and kamikaze set
-                activeEnemies_.erase(
-                    std::remove(activeEnemies_.begin(), activeEnemies_.end(), bossEntity_),
-                    activeEnemies_.end());
-                kamikazeEntities_.erase(bossEntity_);
+                // Remove from activeEnemies_, fire patterns and kamikaze set
+                untrackEnemy(bossEntity_);
                 addScore(500); // Boss kill score
                 
                 if (currentLevel_ < (int)s_soloLevelConfigs.size()) {
                     currentLevel_++;
                     startLevel(currentLevel_);
                 } else {
-                    int finalScore = (coordinator && coordinator->HasComponent<Score>(playerEntity_))
-                        ? coordinator->GetComponent<Score>(playerEntity_).current : 0;
+                    int finalScore = (coordinator && coordinator->IsAlive(playerEntity_))
+                        ? coordinator->GetComponent<Score>(playerEntity_.index).current : 0;
                     game_->getStateManager()->pushState(
                         std::make_unique<VictoryState>(game_, finalScore, currentLevel_));
                     levelActive_ = false;
@@ -3763,6 +3773,7 @@ void PlayState::spawnBoss() {
     Collider collider;
     collider.width = bossSprite.textureRect.width * bossSprite.scaleX;
     collider.height = bossSprite.textureRect.height * bossSprite.scaleY;
+    collisionLayers_.assign(collider, "enemy");
     coordinator->AddComponent<Collider>(boss, collider);
     
     // Tag
@@ -3778,7 +3789,7 @@ void PlayState::spawnBoss() {
     enemyFirePatterns_[boss] = config.bossFirePattern;
     
     bossEntity_ = boss;
-    activeEnemies_.push_back(boss);
+    activeEnemies_.push_back(coordinator->GetHandle(boss));
     
     // Play boss music
     if (auto* music = game_->getMusicManager()) {
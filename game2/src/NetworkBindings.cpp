@@ -112,7 +112,7 @@ void NetworkBindings::RegisterNetworkClient(sol::state& lua, NetworkClient* clie
             return sol::nullopt;
         }
 
-        NetworkPacket packet = client->getNextReceivedPacket();
+        PacketView packet = client->getNextReceivedPacket();
         
         // Créer une table Lua pour le paquet
         auto& lua = Scripting::LuaState::Instance().GetState();
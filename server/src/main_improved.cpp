@@ -9,6 +9,7 @@
 #include "network/NetworkServer.hpp"
 #include "network/RTypeProtocol.hpp"
 #include "engine/Clock.hpp"
+#include "physics/SpatialHash.hpp"
 #include "ServerConfig.hpp"
 
 // Hash function for asio::ip::udp::endpoint to use in unordered_map
@@ -71,6 +72,107 @@ struct ServerEntity {
     float collisionCooldown = 0.0f;
 };
 
+// Per-room spatial index, rebuilt once per tick by updateEntities from the
+// moved positions. Entity pointers stay valid for the whole tick: gs.entities
+// is node-based (spawning never moves elements) and erasing waits for the
+// end of the tick. Items are numbered in gs.entities iteration order, so
+// "first match" keeps meaning what it meant with the full scans.
+struct RoomSpatialIndex {
+    eng::engine::physics::SpatialHash monsters;
+    eng::engine::physics::SpatialHash players;
+    std::vector<ServerEntity*> monsterEntities; // grid item -> entity
+    std::vector<ServerEntity*> playerEntities;
+    std::vector<ServerEntity*> updated;         // entities still simulated this tick
+
+    static eng::engine::physics::Aabb boxOf(const ServerEntity& e) {
+        return {e.x, e.y, e.x + e.width, e.y + e.height};
+    }
+
+    void clear() {
+        monsters.clear();
+        players.clear();
+        monsterEntities.clear();
+        playerEntities.clear();
+        updated.clear();
+    }
+
+    void add(ServerEntity& e) {
+        updated.push_back(&e);
+        if (e.type == EntityType::ENTITY_MONSTER) {
+            monsters.insert(boxOf(e));
+            monsterEntities.push_back(&e);
+        } else if (e.type == EntityType::ENTITY_PLAYER) {
+            players.insert(boxOf(e));
+            playerEntities.push_back(&e);
+        }
+    }
+
+    void build() {
+        monsters.build();
+        players.build();
+    }
+
+    // First living monster overlapping `e` (a monster already killed this tick cannot be hit again)
+    ServerEntity* firstMonsterHit(const ServerEntity& e) {
+        return firstOverlap(monsters, monsterEntities, e, [](const ServerEntity& m) { return m.hp > 0; });
+    }
+
+    ServerEntity* firstPlayerHit(const ServerEntity& e) {
+        return firstOverlap(players, playerEntities, e, [](const ServerEntity&) { return true; });
+    }
+
+    // Nearest monster strictly closer than `radius` (distances between entity origins)
+    const ServerEntity* nearestMonster(const ServerEntity& from, float radius) {
+        const ServerEntity* nearest = nullptr;
+        uint32_t nearestItem = 0;
+        float nearestDist = radius;
+        monsters.query({from.x - radius, from.y - radius, from.x + radius, from.y + radius}, [&](std::uint32_t item) {
+            const ServerEntity* m = monsterEntities[item];
+            float dx = m->x - from.x;
+            float dy = m->y - from.y;
+            float dist = std::sqrt(dx * dx + dy * dy);
+            if (dist < nearestDist || (nearest && dist == nearestDist && item < nearestItem)) {
+                nearestDist = dist;
+                nearest = m;
+                nearestItem = item;
+            }
+        });
+        return nearest;
+    }
+
+    // A handful of players per room: a scan of the player list
+    const ServerEntity* nearestPlayer(const ServerEntity& from) const {
+        float nearestDist = 999999.0f;
+        const ServerEntity* nearest = nullptr;
+        for (const ServerEntity* p : playerEntities) {
+            float dx = p->x - from.x;
+            float dy = p->y - from.y;
+            float dist = std::sqrt(dx * dx + dy * dy);
+            if (dist < nearestDist) {
+                nearestDist = dist;
+                nearest = p;
+            }
+        }
+        return nearest;
+    }
+
+private:
+    template<typename Accept>
+    static ServerEntity* firstOverlap(eng::engine::physics::SpatialHash& grid, const std::vector<ServerEntity*>& entities,
+                                      const ServerEntity& e, Accept accept) {
+        ServerEntity* first = nullptr;
+        uint32_t firstItem = 0;
+        grid.query(boxOf(e), [&](std::uint32_t item) {
+            ServerEntity* candidate = entities[item];
+            if (candidate != &e && accept(*candidate) && (!first || item < firstItem)) {
+                first = candidate;
+                firstItem = item;
+            }
+        });
+        return first;
+    }
+};
+
 // Per-room game state: each room has its own independent game simulation
 struct RoomGameState {
     uint32_t roomId = 0;
@@ -102,6 +204,12 @@ struct RoomGameState {
         bool active = false;
     };
     WaveSpawnState waveSpawnState;
+
+    // Rebuilt every tick; kept here so its buffers are reused
+    RoomSpatialIndex spatial;
+
+    // Recent snapshots of this room, baselines for the per-client deltas
+    SnapshotHistory snapshots;
 };
 
 class GameServer {
@@ -610,7 +718,7 @@ private:
         }
     }
 
-    void handleClientHello(const NetworkPacket&, const asio::ip::udp::endpoint& sender) {
+    void handleClientHello(const PacketView&, const asio::ip::udp::endpoint& sender) {
         // Assign player ID but don't create game entity yet
         // Entity will be created when the room starts (GAME_START)
         uint8_t playerId = nextPlayerId_++;
@@ -630,14 +738,15 @@ private:
         // Don't create entity or broadcast yet - wait for game to start
     }
 
-    void handleClientInput(const NetworkPacket& packet, const asio::ip::udp::endpoint&) {
-        if (packet.payload.size() < sizeof(ClientInput)) {
-            LOG_ERROR("GAMESERVER", "INPUT: payload too small");
+    void handleClientInput(const PacketView& packet, const asio::ip::udp::endpoint&) {
+        ClientInput input;
+        try {
+            input = RTypeProtocol::getClientInput(packet.header, packet.payload);
+        } catch (const std::exception& e) {
+            LOG_ERROR("GAMESERVER", "INPUT: " + std::string(e.what()));
             return;
         }
         
-        ClientInput input = ClientInput::deserialize(packet.payload.data());
-        
         // Find which room this player belongs to
         auto roomIt = playerToRoom_.find(input.playerId);
         if (roomIt == playerToRoom_.end()) {
@@ -666,9 +775,11 @@ private:
         
         ServerEntity& player = entityIt->second;
 
-        // Track input sequence for lag compensation acks
+        // Track input sequence for lag compensation acks, and the snapshot the
+        // client rebuilt last as its delta baseline (older inputs carry older acks)
         if (input.inputSeq > lastProcessedInputSeq_[input.playerId]) {
             lastProcessedInputSeq_[input.playerId] = input.inputSeq;
+            lastAckedSnapshotSeq_[input.playerId] = input.lastSnapshotSeq;
         }
 
         // Apply input
@@ -708,7 +819,7 @@ private:
     }
 
     //  NOUVEAU: Handler pour CLIENT_PING
-    void handleClientPing(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleClientPing(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         auto session = server_.getSession(sender);
         if (session) {
             // Update last packet time to prevent timeout
@@ -813,7 +924,11 @@ private:
 
     void updateEntities(float deltaTime, RoomGameState& gs) {
         std::vector<uint32_t> toRemove;
+        RoomSpatialIndex& index = gs.spatial;
+        index.clear();
         
+        // Pass 1: lifetimes, movement and bounds. Nothing is spawned here, so
+        // iterating gs.entities directly is safe.
         for (auto& [id, entity] : gs.entities) {
             //  Update lifetime for temporary entities (explosions, etc.)
             if (entity.lifetime > 0.0f) {
@@ -841,56 +956,11 @@ private:
                 entity.vy = entity.waveAmplitude * angularFreq * std::cos(angularFreq * entity.waveTime);
             }
             
-            // Homing projectile: track nearest enemy
-            if (entity.type == EntityType::ENTITY_PLAYER_MISSILE && entity.projectileType == 3) {
-                const ServerEntity* nearest = nullptr;
-                float nearestDist = cfg_.modules.homing.detectionRadius;
-                for (auto& [eid, e] : gs.entities) {
-                    if (e.type != EntityType::ENTITY_MONSTER) continue;
-                    float dx = e.x - entity.x;
-                    float dy = e.y - entity.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    if (dist < nearestDist) {
-                        nearestDist = dist;
-                        nearest = &e;
-                    }
-                }
-                if (nearest) {
-                    float dx = nearest->x - entity.x;
-                    float dy = nearest->y - entity.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    if (dist > 0.001f) {
-                        float speed = entity.homingSpeed > 0.0f ? entity.homingSpeed : cfg_.modules.homing.speed;
-                        // Smooth turn towards target
-                        float targetVx = (dx / dist) * speed;
-                        float targetVy = (dy / dist) * speed;
-                        float turnRate = cfg_.modules.homing.turnRate * deltaTime; // Smooth turn
-                        entity.vx += (targetVx - entity.vx) * turnRate;
-                        entity.vy += (targetVy - entity.vy) * turnRate;
-                        // Maintain speed
-                        float currentSpeed = std::sqrt(entity.vx * entity.vx + entity.vy * entity.vy);
-                        if (currentSpeed > 0.001f) {
-                            entity.vx = (entity.vx / currentSpeed) * speed;
-                            entity.vy = (entity.vy / currentSpeed) * speed;
-                        }
-                    }
-                }
-            }
-            
             // Update fire timer
             if (entity.fireTimer > 0.0f) {
                 entity.fireTimer -= deltaTime;
             }
             
-            // Enemy shooting logic (with fire patterns)
-            if (entity.type == EntityType::ENTITY_MONSTER && entity.fireTimer <= 0.0f) {
-                // Only shoot when on screen and has a valid fire pattern
-                if (entity.x < 1800.0f && entity.x > 100.0f && entity.firePattern != 255) {
-                    spawnEnemyMissile(entity, gs);
-                    entity.fireTimer = entity.fireRate + (dist_(rng_) % 100) / 100.0f;
-                }
-            }
-            
             // Zigzag pattern (fighter, enemyType=1): reverse vy periodically
             if (entity.type == EntityType::ENTITY_MONSTER && entity.enemyType == 1) {
                 entity.zigzagTimer += deltaTime;
@@ -903,21 +973,6 @@ private:
                 if (entity.y > cfg_.fighter.boundaryBottom) entity.vy = -std::abs(entity.baseVy);
             }
             
-            // Kamikaze pattern (enemyType=2): rush towards nearest player
-            if (entity.type == EntityType::ENTITY_MONSTER && entity.enemyType == 2) {
-                const ServerEntity* nearestPlayer = findNearestPlayer(entity, gs);
-                if (nearestPlayer) {
-                    float dx = nearestPlayer->x - entity.x;
-                    float dy = nearestPlayer->y - entity.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-                    if (dist > 0.001f) {
-                        float speed = cfg_.kamikaze.trackingSpeed;
-                        entity.vx = (dx / dist) * speed;
-                        entity.vy = (dy / dist) * speed;
-                    }
-                }
-            }
-            
             // Boss movement pattern (enemyType >= 3): move to stop_x then bob up/down
             if (entity.type == EntityType::ENTITY_MONSTER && entity.enemyType >= 3) {
                 if (entity.x <= cfg_.bossMovement.stopX) {
@@ -966,53 +1021,106 @@ private:
                 }
             }
             
-            // Check collisions (simple)
+            index.add(entity);
+        }
+        
+        // One spatial index per room and tick, from the moved positions
+        index.build();
+        
+        // Pass 2: targeting, firing and collisions through the index. Walks the
+        // index's entity list: firing and explosions insert into gs.entities.
+        for (ServerEntity* current : index.updated) {
+            ServerEntity& entity = *current;
+            const uint32_t id = entity.id;
+            
+            // Homing projectile: track nearest enemy
+            if (entity.type == EntityType::ENTITY_PLAYER_MISSILE && entity.projectileType == 3) {
+                const ServerEntity* nearest = index.nearestMonster(entity, cfg_.modules.homing.detectionRadius);
+                if (nearest) {
+                    float dx = nearest->x - entity.x;
+                    float dy = nearest->y - entity.y;
+                    float dist = std::sqrt(dx * dx + dy * dy);
+                    if (dist > 0.001f) {
+                        float speed = entity.homingSpeed > 0.0f ? entity.homingSpeed : cfg_.modules.homing.speed;
+                        // Smooth turn towards target
+                        float targetVx = (dx / dist) * speed;
+                        float targetVy = (dy / dist) * speed;
+                        float turnRate = cfg_.modules.homing.turnRate * deltaTime; // Smooth turn
+                        entity.vx += (targetVx - entity.vx) * turnRate;
+                        entity.vy += (targetVy - entity.vy) * turnRate;
+                        // Maintain speed
+                        float currentSpeed = std::sqrt(entity.vx * entity.vx + entity.vy * entity.vy);
+                        if (currentSpeed > 0.001f) {
+                            entity.vx = (entity.vx / currentSpeed) * speed;
+                            entity.vy = (entity.vy / currentSpeed) * speed;
+                        }
+                    }
+                }
+            }
+            
+            // Enemy shooting logic (with fire patterns)
+            if (entity.type == EntityType::ENTITY_MONSTER && entity.fireTimer <= 0.0f) {
+                // Only shoot when on screen and has a valid fire pattern
+                if (entity.x < 1800.0f && entity.x > 100.0f && entity.firePattern != 255) {
+                    spawnEnemyMissile(entity, gs);
+                    entity.fireTimer = entity.fireRate + (dist_(rng_) % 100) / 100.0f;
+                }
+            }
+            
+            // Kamikaze pattern (enemyType=2): rush towards nearest player
+            if (entity.type == EntityType::ENTITY_MONSTER && entity.enemyType == 2) {
+                const ServerEntity* nearestPlayer = findNearestPlayer(entity, gs);
+                if (nearestPlayer) {
+                    float dx = nearestPlayer->x - entity.x;
+                    float dy = nearestPlayer->y - entity.y;
+                    float dist = std::sqrt(dx * dx + dy * dy);
+                    if (dist > 0.001f) {
+                        float speed = cfg_.kamikaze.trackingSpeed;
+                        entity.vx = (dx / dist) * speed;
+                        entity.vy = (dy / dist) * speed;
+                    }
+                }
+            }
+            
+            // Check collisions (player missile vs monsters in the same cells)
             if (entity.type == EntityType::ENTITY_PLAYER_MISSILE) {
-                for (auto& [enemyId, enemy] : gs.entities) {
-                    if (enemy.type == EntityType::ENTITY_MONSTER) {
-                        if (checkCollision(entity, enemy)) {
-                            // Calculate damage based on missile charge level
-                            int damage = cfg_.projectiles.player.baseDamage;
-                            if (entity.chargeLevel > 0) {
-                                damage = entity.chargeLevel * cfg_.projectiles.player.chargeDamageMultiplier;
-                            }
-                            
-                            enemy.hp -= damage;
-                            toRemove.push_back(id); // Always destroy missile
-                            
-                            if (enemy.hp <= 0) {
-                                // Enemy killed - award score
-                                uint8_t shooterId = entity.playerId;
-                                for (auto& [playerId, player] : gs.entities) {
-                                    if (player.type == EntityType::ENTITY_PLAYER && player.playerId == shooterId) {
-                                        uint32_t points = (enemy.enemyType >= 3) ? cfg_.bossMovement.score : cfg_.bug.score; // Boss vs normal
-                                        player.score += points;
-                                        break;
-                                    }
-                                }
-                                spawnExplosion(enemy.x, enemy.y, gs);
-                                toRemove.push_back(enemyId);
+                if (ServerEntity* hit = index.firstMonsterHit(entity)) {
+                    ServerEntity& enemy = *hit;
+                    // Calculate damage based on missile charge level
+                    int damage = cfg_.projectiles.player.baseDamage;
+                    if (entity.chargeLevel > 0) {
+                        damage = entity.chargeLevel * cfg_.projectiles.player.chargeDamageMultiplier;
+                    }
+                    
+                    enemy.hp -= damage;
+                    toRemove.push_back(id); // Always destroy missile
+                    
+                    if (enemy.hp <= 0) {
+                        // Enemy killed - award score
+                        uint8_t shooterId = entity.playerId;
+                        for (ServerEntity* player : index.playerEntities) {
+                            if (player->playerId == shooterId) {
+                                uint32_t points = (enemy.enemyType >= 3) ? cfg_.bossMovement.score : cfg_.bug.score; // Boss vs normal
+                                player->score += points;
+                                break;
                             }
-                            break;
                         }
+                        spawnExplosion(enemy.x, enemy.y, gs);
+                        toRemove.push_back(enemy.id);
                     }
                 }
             }
             
             // Check enemy missile vs players
             if (entity.type == EntityType::ENTITY_MONSTER_MISSILE) {
-                for (auto& [playerId, player] : gs.entities) {
-                    if (player.type == EntityType::ENTITY_PLAYER) {
-                        if (checkCollision(entity, player)) {
-                            // No explosion when player is hit - just destroy missile
-                            toRemove.push_back(id);
-                            if (player.shieldTimer <= 0.0f) {
-                                player.hp -= cfg_.projectiles.missileDamage; // Damage player
-                                if (player.hp <= 0) {
-                                    toRemove.push_back(playerId);
-                                }
-                            }
-                            break;
+                if (ServerEntity* hit = index.firstPlayerHit(entity)) {
+                    ServerEntity& player = *hit;
+                    // No explosion when player is hit - just destroy missile
+                    toRemove.push_back(id);
+                    if (player.shieldTimer <= 0.0f) {
+                        player.hp -= cfg_.projectiles.missileDamage; // Damage player
+                        if (player.hp <= 0) {
+                            toRemove.push_back(player.id);
                         }
                     }
                 }
@@ -1020,36 +1128,32 @@ private:
             
             // Check enemy collision with players (crash damage)
             if (entity.type == EntityType::ENTITY_MONSTER) {
-                for (auto& [playerId, player] : gs.entities) {
-                    if (player.type == EntityType::ENTITY_PLAYER) {
-                        if (checkCollision(entity, player)) {
-                            if (entity.enemyType >= 3) {
-                                // Boss: mutual damage, don't destroy boss
-                                // Use collision cooldown to prevent instant death from overlap
-                                if (player.collisionCooldown <= 0.0f && player.shieldTimer <= 0.0f) {
-                                    player.hp -= cfg_.bossMovement.collisionDamageToPlayer;
-                                    player.collisionCooldown = 0.5f; // 500ms between collision damage ticks
-                                    if (player.hp <= 0) {
-                                        toRemove.push_back(playerId);
-                                    }
-                                }
-                                entity.hp -= cfg_.bossMovement.collisionDamageFromPlayer;
-                                if (entity.hp <= 0) {
-                                    spawnExplosion(entity.x, entity.y, gs);
-                                    toRemove.push_back(id);
-                                }
-                            } else {
-                                // Normal enemy: destroy enemy, heavy damage to player
-                                spawnExplosion(entity.x, entity.y, gs);
-                                toRemove.push_back(id);
-                                if (player.shieldTimer <= 0.0f) {
-                                    player.hp -= cfg_.bug.collisionDamage;
-                                    if (player.hp <= 0) {
-                                        toRemove.push_back(playerId);
-                                    }
-                                }
+                if (ServerEntity* hit = index.firstPlayerHit(entity)) {
+                    ServerEntity& player = *hit;
+                    if (entity.enemyType >= 3) {
+                        // Boss: mutual damage, don't destroy boss
+                        // Use collision cooldown to prevent instant death from overlap
+                        if (player.collisionCooldown <= 0.0f && player.shieldTimer <= 0.0f) {
+                            player.hp -= cfg_.bossMovement.collisionDamageToPlayer;
+                            player.collisionCooldown = 0.5f; // 500ms between collision damage ticks
+                            if (player.hp <= 0) {
+                                toRemove.push_back(player.id);
+                            }
+                        }
+                        entity.hp -= cfg_.bossMovement.collisionDamageFromPlayer;
+                        if (entity.hp <= 0) {
+                            spawnExplosion(entity.x, entity.y, gs);
+                            toRemove.push_back(id);
+                        }
+                    } else {
+                        // Normal enemy: destroy enemy, heavy damage to player
+                        spawnExplosion(entity.x, entity.y, gs);
+                        toRemove.push_back(id);
+                        if (player.shieldTimer <= 0.0f) {
+                            player.hp -= cfg_.bug.collisionDamage;
+                            if (player.hp <= 0) {
+                                toRemove.push_back(player.id);
                             }
-                            break;
                         }
                     }
                 }
@@ -1057,60 +1161,51 @@ private:
             
             // Check powerup collision with players
             if (entity.type == EntityType::ENTITY_POWERUP) {
-                for (auto& [playerId, player] : gs.entities) {
-                    if (player.type == EntityType::ENTITY_PLAYER) {
-                        if (checkCollision(entity, player)) {
-                            toRemove.push_back(id); // Remove powerup
-                            
-                            if (entity.enemyType == 0) {
-                                // ORANGE BOMB: destroy all visible enemies, but only deal fraction HP to boss
-                                LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up BOMB!");
-                                float margin = cfg_.collisions.oobMargin;
-                                for (auto& [eid, e] : gs.entities) {
-                                    if (e.type == EntityType::ENTITY_MONSTER) {
-                                        if (e.x >= -margin && e.x <= cfg_.collisions.screenWidth + margin && 
-                                            e.y >= -margin && e.y <= cfg_.collisions.screenHeight + margin) {
-                                            if (e.enemyType >= 3) {
-                                                // Boss: deal fraction of boss config max HP
-                                                auto bossConfig = getLevelConfig(gs.currentLevel).boss;
-                                                int bossDamage = static_cast<int>(bossConfig.health * cfg_.powerups.orange.bossDamageFraction);
-                                                e.hp -= bossDamage;
-                                                LOG_INFO("GAMESERVER", " Bomb dealt " + std::to_string(bossDamage) + " to boss (HP: " + std::to_string(e.hp) + ")");
-                                                if (e.hp <= 0) {
-                                                    spawnExplosion(e.x, e.y, gs);
-                                                    toRemove.push_back(eid);
-                                                }
-                                            } else {
-                                                spawnExplosion(e.x, e.y, gs);
-                                                toRemove.push_back(eid);
-                                            }
-                                        }
+                if (ServerEntity* hit = index.firstPlayerHit(entity)) {
+                    ServerEntity& player = *hit;
+                    toRemove.push_back(id); // Remove powerup
+                    
+                    if (entity.enemyType == 0) {
+                        // ORANGE BOMB: destroy all visible enemies, but only deal fraction HP to boss
+                        LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up BOMB!");
+                        float margin = cfg_.collisions.oobMargin;
+                        for (ServerEntity* monster : index.monsterEntities) {
+                            ServerEntity& e = *monster;
+                            if (e.x >= -margin && e.x <= cfg_.collisions.screenWidth + margin && 
+                                e.y >= -margin && e.y <= cfg_.collisions.screenHeight + margin) {
+                                if (e.enemyType >= 3) {
+                                    // Boss: deal fraction of boss config max HP
+                                    auto bossConfig = getLevelConfig(gs.currentLevel).boss;
+                                    int bossDamage = static_cast<int>(bossConfig.health * cfg_.powerups.orange.bossDamageFraction);
+                                    e.hp -= bossDamage;
+                                    LOG_INFO("GAMESERVER", " Bomb dealt " + std::to_string(bossDamage) + " to boss (HP: " + std::to_string(e.hp) + ")");
+                                    if (e.hp <= 0) {
+                                        spawnExplosion(e.x, e.y, gs);
+                                        toRemove.push_back(e.id);
                                     }
+                                } else {
+                                    spawnExplosion(e.x, e.y, gs);
+                                    toRemove.push_back(e.id);
                                 }
-                            } else if (entity.enemyType == 1) {
-                                // BLUE SHIELD: make player invulnerable
-                                LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up SHIELD!");
-                                player.shieldTimer = cfg_.powerups.blue.duration;
-                                player.chargeLevel = 99; // Signal to client that shield is active
                             }
-                            break;
                         }
+                    } else if (entity.enemyType == 1) {
+                        // BLUE SHIELD: make player invulnerable
+                        LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up SHIELD!");
+                        player.shieldTimer = cfg_.powerups.blue.duration;
+                        player.chargeLevel = 99; // Signal to client that shield is active
                     }
                 }
             }
             
             // Check module collision with players (pickup)
             if (entity.type == EntityType::ENTITY_MODULE) {
-                for (auto& [playerId, player] : gs.entities) {
-                    if (player.type == EntityType::ENTITY_PLAYER) {
-                        if (checkCollision(entity, player)) {
-                            toRemove.push_back(id); // Remove module from world
-                            player.moduleType = entity.enemyType; // 1=laser(homing), 3=spread, 4=wave
-                            const char* names[] = {"", "laser(homing)", "", "spread", "wave"};
-                            LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up module: " + names[entity.enemyType]);
-                            break;
-                        }
-                    }
+                if (ServerEntity* hit = index.firstPlayerHit(entity)) {
+                    ServerEntity& player = *hit;
+                    toRemove.push_back(id); // Remove module from world
+                    player.moduleType = entity.enemyType; // 1=laser(homing), 3=spread, 4=wave
+                    const char* names[] = {"", "laser(homing)", "", "spread", "wave"};
+                    LOG_INFO("GAMESERVER", " Player " + std::to_string((int)player.playerId) + " picked up module: " + names[entity.enemyType]);
                 }
             }
         }
@@ -1160,11 +1255,6 @@ private:
         }
     }
 
-    bool checkCollision(const ServerEntity& a, const ServerEntity& b) {
-        return (a.x < b.x + b.width && a.x + a.width > b.x &&
-                a.y < b.y + b.height && a.y + a.height > b.y);
-    }
-
     // OLD spawnEnemy() replaced by level system's spawnEnemyOfType()
 
     void spawnPlayerMissile(const ServerEntity& player, uint8_t chargeLevel, RoomGameState& gs) {
@@ -1367,21 +1457,9 @@ private:
         broadcastEntitySpawn(missile, gs.roomId);
     }
     
+    // Uses the room's spatial index: only valid during updateEntities' second pass
     const ServerEntity* findNearestPlayer(const ServerEntity& from, const RoomGameState& gs) {
-        float nearestDist = 999999.0f;
-        const ServerEntity* nearest = nullptr;
-        for (const auto& [id, e] : gs.entities) {
-            if (e.type == EntityType::ENTITY_PLAYER) {
-                float dx = e.x - from.x;
-                float dy = e.y - from.y;
-                float dist = std::sqrt(dx * dx + dy * dy);
-                if (dist < nearestDist) {
-                    nearestDist = dist;
-                    nearest = &e;
-                }
-            }
-        }
-        return nearest;
+        return gs.spatial.nearestPlayer(from);
     }
 
     void spawnExplosion(float x, float y, RoomGameState& gs) {
@@ -1406,7 +1484,7 @@ private:
     void sendWorldSnapshot() {
         ++snapshotSeq_;
 
-        // Send one snapshot per room, using each room's own entities
+        // Snapshot each room's own entities, delta-encoded per client
         for (auto& [roomId, gs] : roomStates_) {
             auto room = server_.getRoomManager().getRoom(roomId);
             if (!room || room->state != RoomState::PLAYING) continue;
@@ -1423,58 +1501,62 @@ private:
                 }
             }
 
-            std::vector<const ServerEntity*> snapshotEntities;
-
-            // Add ALL entities from this room's game state
+            // Room state of this tick, kept sorted by id as a future baseline
+            std::vector<EntityState> states;
+            states.reserve(gs.entities.size());
             for (const auto& [id, entity] : gs.entities) {
-                snapshotEntities.push_back(&entity);
+                states.push_back(snapshotState(entity));
             }
+            gs.snapshots.store(snapshotSeq_, states);
+            const std::vector<EntityState>& current = *gs.snapshots.find(snapshotSeq_);
 
-            // Build packet with new format: header + acks + entities
             SnapshotHeader header;
-            header.entityCount = snapshotEntities.size();
             header.snapshotSeq = snapshotSeq_;
-            header.playerAckCount = static_cast<uint8_t>(acks.size());
-
-            NetworkPacket packet(static_cast<uint16_t>(GamePacketType::WORLD_SNAPSHOT));
-            packet.header.timestamp = getCurrentTimestamp();
-
-            auto headerData = header.serialize();
-            packet.payload.insert(packet.payload.end(), headerData.begin(), headerData.end());
-
-            // Serialize acks between header and entities
-            for (const auto& ack : acks) {
-                auto ackData = ack.serialize();
-                packet.payload.insert(packet.payload.end(), ackData.begin(), ackData.end());
-            }
 
-            for (const auto* entity : snapshotEntities) {
-                EntityState state;
-                state.id = entity->id;
-                state.type = entity->type;
-                state.x = entity->x;
-                state.y = entity->y;
-                state.vx = entity->vx;
-                state.vy = entity->vy;
-                state.hp = static_cast<uint16_t>(std::min(entity->hp, (int32_t)65535));
-                state.playerLine = entity->playerLine;
-                state.playerId = entity->playerId;
-                state.chargeLevel = entity->chargeLevel;
-                state.enemyType = entity->enemyType;
-                state.score = entity->score;
-                // For players: send moduleType via projectileType field
-                if (entity->type == EntityType::ENTITY_PLAYER) {
-                    state.projectileType = entity->moduleType;
-                } else {
-                    state.projectileType = entity->projectileType;
+            // Each client gets a delta against the last snapshot it acked, or a
+            // full one once that left the ring; clients on the same baseline share a packet
+            std::unordered_map<uint32_t, NetworkPacket> packets; // baselineSeq -> packet
+            for (const auto& session : server_.getActiveSessions()) {
+                if (std::find(room->playerIds.begin(), room->playerIds.end(), session.playerId) == room->playerIds.end()) {
+                    continue;
                 }
+                auto ackIt = lastAckedSnapshotSeq_.find(session.playerId);
+                const uint32_t ackSeq = ackIt != lastAckedSnapshotSeq_.end() ? ackIt->second : 0;
+                const std::vector<EntityState>* baseline = ackSeq != snapshotSeq_ ? gs.snapshots.find(ackSeq) : nullptr;
+                header.baselineSeq = baseline ? ackSeq : 0;
 
-                auto stateData = state.serialize();
-                packet.payload.insert(packet.payload.end(), stateData.begin(), stateData.end());
+                auto packetIt = packets.find(header.baselineSeq);
+                if (packetIt == packets.end()) {
+                    NetworkPacket packet = RTypeProtocol::createWorldSnapshotPacket(header, acks, current, baseline);
+                    packet.header.timestamp = getCurrentTimestamp();
+                    packetIt = packets.emplace(header.baselineSeq, std::move(packet)).first;
+                }
+                server_.sendTo(packetIt->second, session.endpoint);
             }
+        }
+    }
 
-            broadcastToRoom(roomId, packet);
+    EntityState snapshotState(const ServerEntity& entity) const {
+        EntityState state;
+        state.id = entity.id;
+        state.type = entity.type;
+        state.x = entity.x;
+        state.y = entity.y;
+        state.vx = entity.vx;
+        state.vy = entity.vy;
+        state.hp = static_cast<uint16_t>(std::min(entity.hp, (int32_t)65535));
+        state.playerLine = entity.playerLine;
+        state.playerId = entity.playerId;
+        state.chargeLevel = entity.chargeLevel;
+        state.enemyType = entity.enemyType;
+        state.score = entity.score;
+        // For players: send moduleType via projectileType field
+        if (entity.type == EntityType::ENTITY_PLAYER) {
+            state.projectileType = entity.moduleType;
+        } else {
+            state.projectileType = entity.projectileType;
         }
+        return state;
     }
 
     void broadcastEntitySpawn(const ServerEntity& entity, uint32_t roomId) {
@@ -1534,7 +1616,7 @@ private:
         LOG_INFO("GAMESERVER", "Sent room list (" + std::to_string(rooms.size()) + " rooms) to " + (sender.address().to_string() + ":" + std::to_string(sender.port())));
     }
     
-    void handleCreateRoom(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleCreateRoom(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         try {
             CreateRoomPayload payload = CreateRoomPayload::deserialize(packet.payload);
             
@@ -1599,7 +1681,7 @@ private:
         }
     }
     
-    void handleJoinRoom(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleJoinRoom(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         try {
             JoinRoomPayload payload = JoinRoomPayload::deserialize(packet.payload);
             
@@ -1652,7 +1734,7 @@ private:
         }
     }
     
-    void handleLeaveRoom(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleLeaveRoom(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         auto session = server_.getSession(sender);
         if (!session) {
             LOG_ERROR("GAMESERVER", "ROOM_LEAVE from unknown client");
@@ -1701,6 +1783,7 @@ private:
         // Clear session room info
         session->roomId = 0;
         playerToRoom_.erase(playerId);
+        lastAckedSnapshotSeq_.erase(playerId);
         
         // Broadcast updated player list to remaining room members
         broadcastRoomPlayers(roomId);
@@ -1708,7 +1791,7 @@ private:
         // Note: Room cleanup (if empty) is handled by RoomManager
     }
     
-    void handlePlayerReady(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handlePlayerReady(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         auto session = server_.getSession(sender);
         if (!session || session->roomId == 0) {
             LOG_ERROR("GAMESERVER", "PLAYER_READY from player not in a room");
@@ -1737,7 +1820,7 @@ private:
         }
     }
     
-    void handleGameStart(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleGameStart(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         auto session = server_.getSession(sender);
         if (!session || session->roomId == 0) {
             LOG_ERROR("GAMESERVER", "GAME_START from player not in a room");
@@ -1821,7 +1904,7 @@ private:
         gameRunning_ = true;
     }
 
-    void handleClientTogglePause(const NetworkPacket& /*packet*/, const asio::ip::udp::endpoint& sender) {
+    void handleClientTogglePause(const PacketView& /*packet*/, const asio::ip::udp::endpoint& sender) {
         auto session = server_.getSession(sender);
         if (!session || session->roomId == 0) {
             LOG_ERROR("GAMESERVER", "CLIENT_TOGGLE_PAUSE from player not in a room");
@@ -1910,7 +1993,7 @@ private:
     }
     
     // NOUVEAU: Handler pour les messages de chat (Problème 4)
-    void handleChatMessage(const NetworkPacket& packet, const asio::ip::udp::endpoint& sender) {
+    void handleChatMessage(const PacketView& packet, const asio::ip::udp::endpoint& sender) {
         try {
             auto session = server_.getSession(sender);
             if (!session || session->roomId == 0) {
@@ -1955,6 +2038,7 @@ private:
 
     // Lag compensation: track last processed input sequence per player
     std::unordered_map<uint8_t, uint32_t> lastProcessedInputSeq_;
+    std::unordered_map<uint8_t, uint32_t> lastAckedSnapshotSeq_; // playerId -> delta baseline
     uint32_t snapshotSeq_ = 0;
 };
 
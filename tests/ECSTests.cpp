@@ -0,0 +1,1270 @@
+#include <gtest/gtest.h>
+#include "ecs/Coordinator.hpp"
+#include "ecs/SparseSet.hpp"
+#include "ecs/ComponentArray.hpp"
+#include "ecs/EntitySet.hpp"
+#include "ecs/CommandBuffer.hpp"
+#include "ecs/SystemScheduler.hpp"
+#include "ecs/ParallelForEach.hpp"
+#include "physics/AabbBatch.hpp"
+#include "physics/CollisionLayers.hpp"
+#include "physics/SpatialHash.hpp"
+#include "rendering/AtlasPacker.hpp"
+#include "rendering/null/NullRenderer.hpp"
+#include "rendering/null/NullTexture.hpp"
+#include "systems/RenderSystem.hpp"
+#include "systems/AnimationSystem.hpp"
+#include "components/Animation.hpp"
+#include "components/Sprite.hpp"
+#include "core/Profiler.hpp"
+#include "systems/CollisionSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct TestPosition {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+}
+
+TEST(SparseSetTest, InsertContainsRemove) {
+    ECS::SparseSet set;
+    set.Insert(3);
+    set.Insert(4000);
+    set.Insert(7);
+
+    EXPECT_TRUE(set.Contains(3));
+    EXPECT_TRUE(set.Contains(4000));
+    EXPECT_FALSE(set.Contains(4));
+    EXPECT_FALSE(set.Contains(100000));
+    EXPECT_EQ(set.Size(), 3);
+
+    // Swap-and-pop: last entity takes the removed slot
+    EXPECT_EQ(set.Remove(3), 0);
+    EXPECT_FALSE(set.Contains(3));
+    EXPECT_EQ(set[0], 7);
+    EXPECT_EQ(set.IndexOf(7), 0);
+    EXPECT_EQ(set.IndexOf(4000), 1);
+}
+
+TEST(SparseSetTest, Clear) {
+    ECS::SparseSet set;
+    set.Insert(1);
+    set.Insert(2);
+    set.Clear();
+
+    EXPECT_TRUE(set.Empty());
+    EXPECT_FALSE(set.Contains(1));
+    EXPECT_EQ(set.IndexOf(2), ECS::SparseSet::INVALID_INDEX);
+}
+
+TEST(ComponentArrayTest, InsertGetRemove) {
+    ECS::ComponentArray<TestPosition> array;
+    array.InsertData(10, TestPosition{1.0f, 2.0f});
+    array.InsertData(20, TestPosition{3.0f, 4.0f});
+    array.InsertData(30, TestPosition{5.0f, 6.0f});
+
+    EXPECT_FLOAT_EQ(array.GetData(20).x, 3.0f);
+
+    array.RemoveData(10);
+    EXPECT_FALSE(array.HasData(10));
+    EXPECT_EQ(array.Size(), 2);
+
+    // Remaining data must still be found after the swap-and-pop
+    EXPECT_FLOAT_EQ(array.GetData(30).y, 6.0f);
+    EXPECT_FLOAT_EQ(array.GetData(20).y, 4.0f);
+    EXPECT_EQ(array.TryGetData(10), nullptr);
+}
+
+TEST(ComponentArrayTest, DenseIterationStaysParallel) {
+    ECS::ComponentArray<TestPosition> array;
+    for (ECS::Entity e = 0; e < 100; ++e) {
+        array.InsertData(e, TestPosition{static_cast<float>(e), 0.0f});
+    }
+    for (ECS::Entity e = 0; e < 100; e += 3) {
+        array.RemoveData(e);
+    }
+
+    const auto& entities = array.Entities();
+    ASSERT_EQ(entities.size(), array.Size());
+    for (std::size_t i = 0; i < array.Size(); ++i) {
+        EXPECT_FLOAT_EQ(array.At(i).x, static_cast<float>(entities[i]));
+    }
+}
+
+TEST(ComponentArrayTest, ReferenceSurvivesInsertion) {
+    // Spawning projectiles while holding the shooter's Position
+    ECS::ComponentArray<TestPosition> array;
+    array.InsertData(0, TestPosition{4.0f, 2.0f});
+    TestPosition& shooter = array.GetData(0);
+
+    for (ECS::Entity e = 1; e < 3 * ECS::ComponentArray<TestPosition>::PAGE_SIZE; ++e) {
+        array.InsertData(e, TestPosition{shooter.x + 10.0f, shooter.y});
+    }
+
+    EXPECT_EQ(&shooter, &array.GetData(0));
+    EXPECT_FLOAT_EQ(shooter.x, 4.0f);
+    EXPECT_FLOAT_EQ(array.GetData(2000).x, 14.0f);
+    EXPECT_FLOAT_EQ(array.GetData(2000).y, 2.0f);
+}
+
+TEST(ComponentArrayTest, Errors) {
+    ECS::ComponentArray<TestPosition> array;
+    array.InsertData(1, TestPosition{});
+
+    EXPECT_THROW(array.InsertData(1, TestPosition{}), std::runtime_error);
+    EXPECT_THROW(array.RemoveData(2), std::runtime_error);
+    EXPECT_THROW(array.GetData(2), std::runtime_error);
+}
+
+namespace {
+    struct TestVelocity {
+        float dx = 0.0f;
+        float dy = 0.0f;
+    };
+
+    ECS::Coordinator MakeCoordinator()
+    {
+        ECS::Coordinator coordinator;
+        coordinator.Init();
+        coordinator.RegisterComponent<TestPosition>();
+        coordinator.RegisterComponent<TestVelocity>();
+        return coordinator;
+    }
+}
+
+TEST(ViewTest, YieldsOnlyMatchingEntities) {
+    auto coordinator = MakeCoordinator();
+    ECS::Entity moving = coordinator.CreateEntity();
+    ECS::Entity still = coordinator.CreateEntity();
+    coordinator.AddComponent(moving, TestPosition{0.0f, 0.0f});
+    coordinator.AddComponent(moving, TestVelocity{2.0f, 1.0f});
+    coordinator.AddComponent(still, TestPosition{5.0f, 5.0f});
+
+    int visited = 0;
+    coordinator.View<TestPosition, TestVelocity>().Each(
+        [&](ECS::Entity entity, TestPosition& pos, TestVelocity& vel) {
+            EXPECT_EQ(entity, moving);
+            pos.x += vel.dx;
+            ++visited;
+        });
+
+    EXPECT_EQ(visited, 1);
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestPosition>(moving).x, 2.0f);
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestPosition>(still).x, 5.0f);
+}
+
+TEST(ViewTest, RangeForMatchesEach) {
+    auto coordinator = MakeCoordinator();
+    for (int i = 0; i < 10; ++i) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            coordinator.AddComponent(e, TestVelocity{1.0f, 0.0f});
+        }
+    }
+
+    float sum = 0.0f;
+    for (auto [entity, pos, vel] : coordinator.View<TestPosition, TestVelocity>()) {
+        (void)entity;
+        sum += pos.x * vel.dx;
+    }
+    EXPECT_FLOAT_EQ(sum, 0.0f + 2.0f + 4.0f + 6.0f + 8.0f);
+}
+
+TEST(ViewTest, DestroyCurrentEntityDuringEach) {
+    auto coordinator = MakeCoordinator();
+    for (int i = 0; i < 8; ++i) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+    }
+
+    int visited = 0;
+    coordinator.View<TestPosition>().Each([&](ECS::Entity entity, TestPosition& pos) {
+        ++visited;
+        if (static_cast<int>(pos.x) % 2 == 0) {
+            coordinator.DestroyEntity(entity);
+        }
+    });
+
+    EXPECT_EQ(visited, 8);
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 4u);
+}
+
+TEST(TypeIdTest, HashesAreStablePerType) {
+    static_assert(ECS::TypeHashOf<TestPosition>() == ECS::TypeHashOf<TestPosition>());
+    EXPECT_NE(ECS::TypeHashOf<TestPosition>(), ECS::TypeHashOf<TestVelocity>());
+    EXPECT_NE(ECS::TypeHashOf<int>(), ECS::TypeHashOf<unsigned int>());
+}
+
+TEST(TypeIdTest, TypeIndexMapInsertFind) {
+    ECS::TypeIndexMap<8> map;
+    EXPECT_TRUE(map.Insert(1, 10));
+    EXPECT_TRUE(map.Insert(9, 20));   // Same start slot as 1
+    EXPECT_FALSE(map.Insert(1, 30));
+
+    EXPECT_EQ(map.Find(1), 10u);
+    EXPECT_EQ(map.Find(9), 20u);
+    EXPECT_EQ(map.Find(17), ECS::TypeIndexMap<8>::NOT_FOUND);
+}
+
+TEST(ComponentManagerTest, RegistrationRules) {
+    ECS::ComponentManager manager;
+    manager.RegisterComponent<TestPosition>();
+    manager.RegisterComponent<TestVelocity>();
+
+    EXPECT_EQ(manager.GetComponentType<TestPosition>(), 0);
+    EXPECT_EQ(manager.GetComponentType<TestVelocity>(), 1);
+    EXPECT_THROW(manager.RegisterComponent<TestPosition>(), std::runtime_error);
+    EXPECT_THROW(manager.GetComponentType<int>(), std::runtime_error);
+}
+
+TEST(EntityManagerTest, CapacityIsSetAtRuntime) {
+    ECS::Coordinator coordinator;
+    coordinator.Init(ECS::StorageMode::SparseSet, 3);
+    for (int i = 0; i < 3; ++i) {
+        coordinator.CreateEntity();
+    }
+    EXPECT_THROW(coordinator.CreateEntity(), std::runtime_error);
+    EXPECT_THROW(coordinator.SetMaxEntities(2), std::runtime_error);
+
+    // Well past the former compile-time limit of 5000
+    coordinator.SetMaxEntities(20000);
+    for (int i = 3; i < 20000; ++i) {
+        coordinator.CreateEntity();
+    }
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 20000u);
+    EXPECT_THROW(coordinator.CreateEntity(), std::runtime_error);
+}
+
+TEST(SparseSetTest, EmptiedPagesReturnToPool) {
+    ECS::SparseSet set;
+    set.Insert(0);
+
+    // Entities far apart land in distinct pages; emptying a page gives it back
+    const ECS::Entity far = 10 * ECS::SPARSE_PAGE_SIZE + 7;
+    set.Insert(far);
+    EXPECT_TRUE(set.Contains(far));
+    set.Remove(far);
+    EXPECT_FALSE(set.Contains(far));
+    EXPECT_EQ(set.IndexOf(far), ECS::SparseSet::INVALID_INDEX);
+
+    // Reinserting reuses a pooled page, which must come back cleared
+    set.Insert(far + 1);
+    EXPECT_FALSE(set.Contains(far));
+    EXPECT_TRUE(set.Contains(far + 1));
+    EXPECT_TRUE(set.Contains(0));
+}
+
+TEST(EntityHandleTest, StaleHandlesAreRejected) {
+    auto coordinator = MakeCoordinator();
+    EXPECT_FALSE(coordinator.IsAlive(ECS::EntityHandle{}));
+
+    ECS::EntityHandle handle = coordinator.CreateHandle();
+    EXPECT_TRUE(coordinator.IsAlive(handle));
+    EXPECT_EQ(coordinator.GetHandle(handle.index), handle);
+
+    EXPECT_TRUE(coordinator.DestroyEntity(handle));
+    EXPECT_FALSE(coordinator.IsAlive(handle));
+    EXPECT_FALSE(coordinator.DestroyEntity(handle));
+    EXPECT_THROW(coordinator.GetHandle(handle.index), std::runtime_error);
+
+    // A repeated raw destroy must not hand the ID out twice
+    coordinator.DestroyEntity(handle.index);
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 0u);
+
+    // Freed IDs are reused only once enough of them are queued
+    std::vector<ECS::Entity> batch;
+    for (std::uint32_t i = 0; i < ECS::MIN_FREE_ENTITIES; ++i) {
+        batch.push_back(coordinator.CreateEntity());
+    }
+    EXPECT_EQ(std::find(batch.begin(), batch.end(), handle.index), batch.end());
+    for (ECS::Entity e : batch) {
+        coordinator.DestroyEntity(e);
+    }
+    ECS::Entity recycled = coordinator.CreateEntity();
+    ASSERT_EQ(recycled, handle.index);
+    EXPECT_TRUE(coordinator.IsAlive(recycled));
+    EXPECT_FALSE(coordinator.IsAlive(handle));
+    EXPECT_NE(coordinator.GetHandle(recycled).version, handle.version);
+}
+
+namespace {
+    struct TestName {
+        std::string value;
+    };
+
+    ECS::Coordinator MakeArchetypeCoordinator()
+    {
+        ECS::Coordinator coordinator;
+        coordinator.Init(ECS::StorageMode::Archetype);
+        coordinator.RegisterComponent<TestPosition>();
+        coordinator.RegisterComponent<TestVelocity>();
+        coordinator.RegisterComponent<TestName>();
+        return coordinator;
+    }
+}
+
+TEST(ArchetypeStorageTest, AddRemoveMovesBetweenArchetypes) {
+    auto coordinator = MakeArchetypeCoordinator();
+    ECS::Entity e = coordinator.CreateEntity();
+    coordinator.AddComponent(e, TestPosition{1.0f, 2.0f});
+    coordinator.AddComponent(e, TestName{"bullet"});
+    coordinator.AddComponent(e, TestVelocity{3.0f, 4.0f});
+
+    EXPECT_TRUE(coordinator.HasComponent<TestVelocity>(e));
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestPosition>(e).y, 2.0f);
+    EXPECT_EQ(coordinator.GetComponent<TestName>(e).value, "bullet");
+
+    coordinator.RemoveComponent<TestPosition>(e);
+    EXPECT_FALSE(coordinator.HasComponent<TestPosition>(e));
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestVelocity>(e).dx, 3.0f);
+    EXPECT_EQ(coordinator.GetComponent<TestName>(e).value, "bullet");
+
+    EXPECT_THROW(coordinator.RemoveComponent<TestPosition>(e), std::runtime_error);
+    EXPECT_THROW(coordinator.GetComponent<TestPosition>(e), std::runtime_error);
+    EXPECT_THROW(coordinator.AddComponent(e, TestName{}), std::runtime_error);
+}
+
+TEST(ArchetypeStorageTest, SwapAndPopKeepsOtherRows) {
+    auto coordinator = MakeArchetypeCoordinator();
+    std::vector<ECS::Entity> entities;
+    for (int i = 0; i < 3000; ++i) {   // Spans several chunks
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+        coordinator.AddComponent(e, TestName{std::to_string(i)});
+        entities.push_back(e);
+    }
+    for (std::size_t i = 0; i < entities.size(); i += 2) {
+        coordinator.DestroyEntity(entities[i]);
+    }
+
+    for (std::size_t i = 1; i < entities.size(); i += 2) {
+        EXPECT_FLOAT_EQ(coordinator.GetComponent<TestPosition>(entities[i]).x, static_cast<float>(i));
+        EXPECT_EQ(coordinator.GetComponent<TestName>(entities[i]).value, std::to_string(i));
+    }
+}
+
+TEST(ArchetypeStorageTest, ViewScansMatchingArchetypes) {
+    auto coordinator = MakeArchetypeCoordinator();
+    for (int i = 0; i < 100; ++i) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            coordinator.AddComponent(e, TestVelocity{1.0f, 0.0f});
+        }
+        if (i % 3 == 0) {
+            coordinator.AddComponent(e, TestName{"x"});
+        }
+    }
+
+    float eachSum = 0.0f;
+    int eachCount = 0;
+    coordinator.View<TestPosition, TestVelocity>().Each(
+        [&](ECS::Entity, TestPosition& pos, TestVelocity& vel) {
+            eachSum += pos.x * vel.dx;
+            ++eachCount;
+        });
+
+    float rangeSum = 0.0f;
+    int rangeCount = 0;
+    for (auto [entity, pos, vel] : coordinator.View<TestPosition, TestVelocity>()) {
+        EXPECT_TRUE(coordinator.HasComponent<TestVelocity>(entity));
+        rangeSum += pos.x * vel.dx;
+        ++rangeCount;
+    }
+
+    EXPECT_EQ(eachCount, 50);
+    EXPECT_EQ(rangeCount, 50);
+    EXPECT_FLOAT_EQ(eachSum, 2450.0f);
+    EXPECT_FLOAT_EQ(rangeSum, 2450.0f);
+}
+
+TEST(ArchetypeStorageTest, DestroyCurrentEntityDuringEach) {
+    auto coordinator = MakeArchetypeCoordinator();
+    for (int i = 0; i < 600; ++i) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+    }
+
+    int visited = 0;
+    coordinator.View<TestPosition>().Each([&](ECS::Entity entity, TestPosition& pos) {
+        ++visited;
+        if (static_cast<int>(pos.x) % 2 == 0) {
+            coordinator.DestroyEntity(entity);
+        }
+    });
+
+    EXPECT_EQ(visited, 600);
+    EXPECT_EQ(coordinator.View<TestPosition>().SizeHint(), 300u);
+}
+
+TEST(EntitySetTest, SetSemanticsAndSwapAndPopOrder) {
+    ECS::EntitySet set;
+    set.insert(9);
+    set.insert(2);
+    set.insert(9);
+    set.insert(5);
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_EQ(set.erase(42), 0u);
+
+    // Insertion order, not entity order
+    std::vector<ECS::Entity> order(set.begin(), set.end());
+    EXPECT_EQ(order, (std::vector<ECS::Entity>{9, 2, 5}));
+
+    // Erase moves the last member into the hole
+    EXPECT_EQ(set.erase(9), 1u);
+    EXPECT_EQ(set.Dense(), (std::vector<ECS::Entity>{5, 2}));
+    set.insert(1);
+    EXPECT_EQ(set.Dense(), (std::vector<ECS::Entity>{5, 2, 1}));
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_TRUE(set.contains(5));
+    EXPECT_FALSE(set.contains(9));
+
+    // Only membership changes move the version; duplicates, misses and reads do not
+    const std::uint64_t version = set.Version();
+    set.insert(5);
+    EXPECT_EQ(set.erase(42), 0u);
+    (void)set.Dense();
+    EXPECT_EQ(set.Version(), version);
+    set.erase(5);
+    set.insert(5);
+    EXPECT_EQ(set.Version(), version + 2);
+}
+
+TEST(EntitySetTest, MutationDuringIterationStaysInBounds) {
+    ECS::EntitySet set;
+    for (ECS::Entity e = 0; e < 4; ++e) {
+        set.insert(e);
+    }
+
+    int visited = 0;
+    for (ECS::Entity entity : set) {
+        ++visited;
+        if (entity == 1) {
+            set.erase(3);
+            for (ECS::Entity e = 100; e < 200; ++e) {
+                set.insert(e);
+            }
+        }
+        if (visited > 200) {
+            break;
+        }
+    }
+    EXPECT_LE(visited, 200);
+    EXPECT_EQ(set.size(), 103u);
+}
+
+namespace {
+    class CountingSystem : public ECS::System {
+     public:
+            void Init() override {}
+            void Update(float) override {}
+            void Shutdown() override {}
+            const ECS::EntitySet& Entities() const { return mEntities; }
+    };
+
+    class MovingSystem : public CountingSystem {};
+    class EverythingSystem : public CountingSystem {};
+}
+
+TEST(SystemManagerTest, MembershipFollowsSignatureChanges) {
+    auto coordinator = MakeCoordinator();
+    auto moving = coordinator.RegisterSystem<MovingSystem>();
+    auto everything = coordinator.RegisterSystem<EverythingSystem>();
+
+    ECS::Signature signature;
+    signature.set(coordinator.GetComponentType<TestPosition>());
+    signature.set(coordinator.GetComponentType<TestVelocity>());
+    coordinator.SetSystemSignature<MovingSystem>(signature);
+
+    ECS::Entity a = coordinator.CreateEntity();
+    ECS::Entity b = coordinator.CreateEntity();
+    coordinator.AddComponent(a, TestPosition{});
+    coordinator.AddComponent(b, TestPosition{});
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+    EXPECT_EQ(everything->GetEntityCount(), 2u);
+
+    coordinator.AddComponent(b, TestVelocity{});
+    coordinator.AddComponent(a, TestVelocity{});
+    EXPECT_EQ(moving->Entities().Dense(), (std::vector<ECS::Entity>{b, a}));
+
+    coordinator.RemoveComponent<TestPosition>(a);
+    EXPECT_EQ(moving->Entities().Dense(), (std::vector<ECS::Entity>{b}));
+
+    coordinator.DestroyEntity(b);
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+    EXPECT_EQ(everything->GetEntityCount(), 1u);
+}
+
+TEST(SystemManagerTest, ChangingSignatureReindexesSystem) {
+    auto coordinator = MakeCoordinator();
+    auto moving = coordinator.RegisterSystem<MovingSystem>();
+
+    ECS::Signature positionOnly;
+    positionOnly.set(coordinator.GetComponentType<TestPosition>());
+    coordinator.SetSystemSignature<MovingSystem>(positionOnly);
+
+    ECS::Signature velocityOnly;
+    velocityOnly.set(coordinator.GetComponentType<TestVelocity>());
+    coordinator.SetSystemSignature<MovingSystem>(velocityOnly);
+
+    ECS::Entity e = coordinator.CreateEntity();
+    coordinator.AddComponent(e, TestPosition{});
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+    coordinator.AddComponent(e, TestVelocity{});
+    EXPECT_EQ(moving->GetEntityCount(), 1u);
+}
+
+TEST(CommandBufferTest, ChangesApplyAtFlush) {
+    auto coordinator = MakeCoordinator();
+    auto moving = coordinator.RegisterSystem<MovingSystem>();
+    ECS::Signature signature;
+    signature.set(coordinator.GetComponentType<TestPosition>());
+    signature.set(coordinator.GetComponentType<TestVelocity>());
+    coordinator.SetSystemSignature<MovingSystem>(signature);
+
+    ECS::CommandBuffer commands(&coordinator);
+    ECS::Entity e = commands.CreateEntity();
+    commands.AddComponent(e, TestPosition{1.0f, 2.0f});
+    commands.AddComponent(e, TestVelocity{3.0f, 4.0f});
+    EXPECT_EQ(commands.Size(), 2u);
+    EXPECT_FALSE(coordinator.HasComponent<TestPosition>(e));
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+
+    commands.Flush();
+    EXPECT_TRUE(commands.Empty());
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestVelocity>(e).dy, 4.0f);
+    EXPECT_EQ(moving->Entities().Dense(), (std::vector<ECS::Entity>{e}));
+
+    commands.RemoveComponent<TestVelocity>(e);
+    commands.Flush();
+    EXPECT_FALSE(coordinator.HasComponent<TestVelocity>(e));
+    EXPECT_TRUE(coordinator.GetEntitySignature(e).test(coordinator.GetComponentType<TestPosition>()));
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+}
+
+TEST(CommandBufferTest, DestroyWinsAndIsCoalesced) {
+    auto coordinator = MakeCoordinator();
+    ECS::CommandBuffer commands(&coordinator);
+
+    ECS::Entity kept = coordinator.CreateEntity();
+    ECS::Entity doomed = coordinator.CreateEntity();
+    coordinator.AddComponent(doomed, TestPosition{});
+
+    commands.DestroyEntity(doomed);
+    commands.AddComponent(doomed, TestVelocity{});
+    commands.DestroyEntity(doomed);
+    commands.AddComponent(kept, TestPosition{});
+    EXPECT_TRUE(commands.IsDestroyQueued(doomed));
+    EXPECT_FALSE(commands.IsDestroyQueued(kept));
+    EXPECT_EQ(commands.Size(), 3u);
+
+    commands.Flush();
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 1u);
+    EXPECT_FALSE(coordinator.HasComponent<TestPosition>(doomed));
+    EXPECT_TRUE(coordinator.HasComponent<TestPosition>(kept));
+    EXPECT_FALSE(commands.IsDestroyQueued(doomed));
+}
+
+TEST(CommandBufferTest, SkipsEntityDestroyedBeforeFlush) {
+    auto coordinator = MakeCoordinator();
+    ECS::CommandBuffer commands(&coordinator);
+
+    ECS::Entity doomed = coordinator.CreateEntity();
+    ECS::Entity kept = coordinator.CreateEntity();
+    commands.AddComponent(doomed, TestPosition{});
+    commands.RemoveComponent<TestVelocity>(doomed);
+    commands.DestroyEntity(doomed);
+    commands.AddComponent(kept, TestPosition{});
+
+    coordinator.DestroyEntity(doomed);
+    EXPECT_NO_THROW(commands.Flush());
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 1u);
+    EXPECT_FALSE(coordinator.HasComponent<TestPosition>(doomed));
+    EXPECT_TRUE(coordinator.HasComponent<TestPosition>(kept));
+}
+
+TEST(CommandBufferTest, RecycledEntityDoesNotInheritCommands) {
+    auto coordinator = MakeCoordinator();
+    ECS::CommandBuffer commands(&coordinator);
+
+    ECS::Entity doomed = coordinator.CreateEntity();
+    commands.AddComponent(doomed, TestPosition{1.0f, 2.0f});
+    commands.DestroyEntity(doomed);
+    coordinator.DestroyEntity(doomed);
+
+    // Churn until the ID comes back for a new entity
+    ECS::Entity reborn = coordinator.CreateEntity();
+    for (int i = 0; reborn != doomed && i < 100000; ++i) {
+        coordinator.DestroyEntity(reborn);
+        reborn = coordinator.CreateEntity();
+    }
+    ASSERT_EQ(reborn, doomed);
+
+    commands.AddComponent(reborn, TestVelocity{3.0f, 4.0f});
+    commands.Flush();
+    EXPECT_TRUE(coordinator.IsAlive(reborn));
+    EXPECT_FALSE(coordinator.HasComponent<TestPosition>(reborn));
+    EXPECT_FLOAT_EQ(coordinator.GetComponent<TestVelocity>(reborn).dy, 4.0f);
+}
+
+TEST(CommandBufferTest, DestroyDuringIterationIsDeferred) {
+    auto coordinator = MakeCoordinator();
+    auto moving = coordinator.RegisterSystem<MovingSystem>();
+    ECS::Signature signature;
+    signature.set(coordinator.GetComponentType<TestPosition>());
+    coordinator.SetSystemSignature<MovingSystem>(signature);
+
+    for (int i = 0; i < 6; ++i) {
+        coordinator.AddComponent(coordinator.CreateEntity(), TestPosition{static_cast<float>(i), 0.0f});
+    }
+
+    ECS::CommandBuffer commands(&coordinator);
+    int visited = 0;
+    for (ECS::Entity entity : moving->Entities()) {
+        ++visited;
+        commands.DestroyEntity(entity);
+    }
+    EXPECT_EQ(visited, 6);
+    EXPECT_EQ(moving->GetEntityCount(), 6u);
+
+    commands.Flush();
+    EXPECT_EQ(moving->GetEntityCount(), 0u);
+    EXPECT_EQ(coordinator.GetLivingEntityCount(), 0u);
+}
+
+TEST(CommandBufferTest, FailedCommandKeepsSignatureConsistent) {
+    auto coordinator = MakeCoordinator();
+    ECS::CommandBuffer commands(&coordinator);
+    ECS::Entity e = coordinator.CreateEntity();
+
+    commands.AddComponent(e, TestPosition{});
+    commands.RemoveComponent<TestVelocity>(e);
+    EXPECT_THROW(commands.Flush(), std::runtime_error);
+
+    EXPECT_TRUE(commands.Empty());
+    EXPECT_TRUE(coordinator.HasComponent<TestPosition>(e));
+    EXPECT_TRUE(coordinator.GetEntitySignature(e).test(coordinator.GetComponentType<TestPosition>()));
+}
+
+TEST(ThreadPoolTest, RunsNestedTasksAndRethrows) {
+    ECS::ThreadPool pool(3);
+    std::atomic<int> counter{0};
+
+    ECS::TaskGroup group;
+    for (int i = 0; i < 50; ++i) {
+        pool.Submit(group, [&]() {
+            counter.fetch_add(1);
+            pool.Submit(group, [&]() { counter.fetch_add(1); });
+        });
+    }
+    pool.Wait(group);
+    EXPECT_EQ(counter.load(), 100);
+
+    ECS::TaskGroup failing;
+    pool.Submit(failing, []() { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(pool.Wait(failing), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, ZeroWorkersRunOnCaller) {
+    ECS::ThreadPool pool(0);
+    int counter = 0;
+    ECS::TaskGroup group;
+    pool.Submit(group, [&]() { ++counter; });
+    pool.Wait(group);
+    EXPECT_EQ(counter, 1);
+}
+
+namespace {
+    struct TestHealth { int current = 0; };
+
+    // Runs a callback as its update and counts ApplyDeferred calls
+    class ScheduledSystem : public ECS::System {
+     public:
+            ScheduledSystem(std::function<void()> update) : mUpdate(std::move(update)) {}
+            void Init() override {}
+            void Update(float) override { mUpdate(); }
+            void Shutdown() override {}
+            void ApplyDeferred() override { ++applied; }
+            bool Scheduled() const { return IsScheduled(); }
+
+            int applied = 0;
+
+     private:
+            std::function<void()> mUpdate;
+    };
+}
+
+TEST(SystemSchedulerTest, BuildsEdgesOnlyForConflicts) {
+    auto coordinator = MakeCoordinator();
+    coordinator.RegisterComponent<TestHealth>();
+    ECS::SystemScheduler scheduler(&coordinator);
+
+    auto noop = []() {};
+    scheduler.Add(std::make_shared<ScheduledSystem>(noop)).Writes<TestPosition>();
+    scheduler.Add(std::make_shared<ScheduledSystem>(noop)).Writes<TestHealth>();
+    scheduler.Add(std::make_shared<ScheduledSystem>(noop)).Reads<TestPosition>().Writes<TestVelocity>();
+    scheduler.Add(std::make_shared<ScheduledSystem>(noop)).Reads<TestVelocity>();
+    scheduler.Add(std::make_shared<ScheduledSystem>(noop)).Exclusive();
+
+    EXPECT_FALSE(scheduler.DependsOn(1, 0));
+    EXPECT_TRUE(scheduler.DependsOn(2, 0));
+    EXPECT_FALSE(scheduler.DependsOn(2, 1));
+    EXPECT_TRUE(scheduler.DependsOn(3, 2));
+    EXPECT_FALSE(scheduler.DependsOn(3, 0));
+    EXPECT_TRUE(scheduler.DependsOn(4, 1));
+}
+
+TEST(SystemSchedulerTest, ParallelRunMatchesSerialOrder) {
+    for (std::size_t workers : {0u, 3u}) {
+        auto coordinator = MakeCoordinator();
+        coordinator.RegisterComponent<TestHealth>();
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, TestPosition{});
+        coordinator.AddComponent(e, TestVelocity{});
+        coordinator.AddComponent(e, TestHealth{});
+
+        ECS::ThreadPool pool(workers);
+        ECS::SystemScheduler scheduler(&coordinator, &pool);
+
+        auto& pos = coordinator.GetComponent<TestPosition>(e);
+        auto& vel = coordinator.GetComponent<TestVelocity>(e);
+        auto& health = coordinator.GetComponent<TestHealth>(e);
+
+        auto writer = std::make_shared<ScheduledSystem>([&]() { pos.x += 1.0f; });
+        auto reader = std::make_shared<ScheduledSystem>([&]() { vel.dx = pos.x * 10.0f; });
+        auto independent = std::make_shared<ScheduledSystem>([&]() { health.current += 1; });
+        scheduler.Add(writer).Writes<TestPosition>();
+        scheduler.Add(reader).Reads<TestPosition>().Writes<TestVelocity>();
+        scheduler.Add(independent).Writes<TestHealth>();
+        EXPECT_TRUE(writer->Scheduled());
+
+        for (int frame = 0; frame < 20; ++frame) {
+            scheduler.Run(0.016f);
+        }
+        EXPECT_FLOAT_EQ(pos.x, 20.0f);
+        EXPECT_FLOAT_EQ(vel.dx, 200.0f);
+        EXPECT_EQ(health.current, 20);
+        EXPECT_EQ(reader->applied, 20);
+    }
+}
+
+namespace {
+    // Fills a coordinator with moving entities; every third one is static
+    void PopulateMoving(ECS::Coordinator& coordinator, int count)
+    {
+        for (int i = 0; i < count; ++i) {
+            ECS::Entity e = coordinator.CreateEntity();
+            coordinator.AddComponent(e, TestPosition{static_cast<float>(i), 0.0f});
+            if (i % 3 != 0) {
+                coordinator.AddComponent(e, TestVelocity{1.0f, static_cast<float>(i % 7)});
+            }
+        }
+    }
+}
+
+TEST(ParallelForEachTest, MatchesSerialEachInBothStorageModes) {
+    ECS::ThreadPool pool(3);
+    ECS::ParallelOptions options;
+    options.minEntities = 64;
+    options.chunkSize = 100;
+
+    for (bool archetypes : {false, true}) {
+        auto coordinator = archetypes ? MakeArchetypeCoordinator() : MakeCoordinator();
+        PopulateMoving(coordinator, 1500);
+
+        std::atomic<int> visited{0};
+        ECS::ParallelForEach(&pool, coordinator.View<TestPosition, TestVelocity>(),
+            [&visited](ECS::Entity, TestPosition& pos, TestVelocity& vel) {
+                pos.x += vel.dx;
+                pos.y += vel.dy;
+                visited.fetch_add(1, std::memory_order_relaxed);
+            }, options);
+        EXPECT_EQ(visited.load(), 1000);
+
+        for (auto [entity, pos] : coordinator.View<TestPosition>()) {
+            const int i = static_cast<int>(entity);
+            EXPECT_FLOAT_EQ(pos.x, static_cast<float>(i) + (i % 3 != 0 ? 1.0f : 0.0f));
+            EXPECT_FLOAT_EQ(pos.y, i % 3 != 0 ? static_cast<float>(i % 7) : 0.0f);
+        }
+    }
+}
+
+TEST(ParallelForEachTest, CollectIsIndependentOfWorkerCount) {
+    ECS::ParallelOptions options;
+    options.minEntities = 1;
+    options.chunkSize = 64;
+
+    std::vector<std::vector<ECS::Entity>> results;
+    for (std::size_t workers : {0u, 1u, 4u}) {
+        auto coordinator = MakeCoordinator();
+        PopulateMoving(coordinator, 1000);
+
+        ECS::ThreadPool pool(workers);
+        results.push_back(ECS::ParallelCollect(&pool, coordinator.View<TestVelocity>(),
+            [](ECS::Entity, TestVelocity& vel) { return vel.dy > 4.0f; }, options));
+    }
+
+    EXPECT_FALSE(results[0].empty());
+    EXPECT_EQ(results[0], results[1]);
+    EXPECT_EQ(results[0], results[2]);
+}
+
+TEST(SpatialHashTest, FindsExactlyThePairwiseOverlaps) {
+    using eng::engine::physics::Aabb;
+
+    std::vector<Aabb> boxes;
+    std::uint32_t seed = 12345;
+    auto next = [&seed](float range) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * range;
+    };
+    for (int i = 0; i < 600; ++i) {
+        const float x = next(2000.0f) - 500.0f;
+        const float y = next(1200.0f) - 300.0f;
+        // Mostly small boxes, a few spanning many cells
+        const float size = (i % 97 == 0) ? 900.0f : 8.0f + next(120.0f);
+        boxes.push_back({x, y, x + size, y + size * 0.5f});
+    }
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> expected;
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+        for (std::uint32_t j = i + 1; j < boxes.size(); ++j) {
+            if (eng::engine::physics::overlaps(boxes[i], boxes[j])) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+
+    eng::engine::physics::SpatialHash grid(64.0f);
+    for (int frame = 0; frame < 2; ++frame) {
+        grid.clear();
+        for (const Aabb& box : boxes) {
+            grid.insert(box);
+        }
+        grid.build();
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> found;
+        grid.forEachPair([&found](std::uint32_t a, std::uint32_t b) { found.emplace_back(a, b); });
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(AabbBatchTest, SimdKernelMatchesScalar) {
+    eng::engine::physics::AabbSoA others;
+    std::uint32_t seed = 777;
+    auto next = [&seed](float range) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * range;
+    };
+    for (int i = 0; i < 203; ++i) {
+        const float x = next(400.0f);
+        const float y = next(400.0f);
+        others.push_back({x, y, x + 10.0f + next(40.0f), y + 10.0f + next(40.0f)}, 1u << (i % 3), (i % 5 == 0) ? 0x2u : ~0u);
+    }
+
+    std::vector<std::uint32_t> scalarHits(others.size());
+    std::vector<std::uint32_t> simdHits(others.size());
+    for (std::uint32_t mask : {~0u, 0x1u, 0x6u}) {
+        for (std::size_t first : {std::size_t{0}, std::size_t{3}, std::size_t{97}}) {
+            const eng::engine::physics::Aabb query{100.0f, 120.0f, 260.0f, 300.0f};
+            std::size_t scalarTests = 0;
+            std::size_t simdTests = 0;
+            const std::size_t scalarCount = eng::engine::physics::overlapOneVsManyScalar(
+                query, 0x2u, mask, others, first, others.size(), scalarHits.data(), scalarTests);
+            const std::size_t simdCount = eng::engine::physics::overlapOneVsMany(
+                query, 0x2u, mask, others, first, others.size(), simdHits.data(), simdTests);
+
+            ASSERT_EQ(simdCount, scalarCount);
+            EXPECT_GT(scalarCount, 0u);
+            EXPECT_EQ(simdTests, scalarTests);
+            EXPECT_TRUE(std::equal(scalarHits.begin(), scalarHits.begin() + scalarCount, simdHits.begin()));
+        }
+    }
+}
+
+TEST(CollisionSystemTest, ReportsPairsInScanOrderAndSkipsDestroyed) {
+    auto coordinator = MakeCoordinator();
+    coordinator.RegisterComponent<Position>();
+    coordinator.RegisterComponent<Collider>();
+    auto system = coordinator.RegisterSystem<CollisionSystem>(&coordinator);
+    ECS::Signature sig;
+    sig.set(coordinator.GetComponentType<Position>());
+    sig.set(coordinator.GetComponentType<Collider>());
+    coordinator.SetSystemSignature<CollisionSystem>(sig);
+
+    // Three overlapping boxes, one far away, one disabled
+    std::vector<ECS::Entity> entities;
+    for (float x : {0.0f, 10.0f, 20.0f, 5000.0f, 15.0f}) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, Position{x, 0.0f});
+        entities.push_back(e);
+    }
+    // Joining the system in reverse: pairs still come in entity order
+    for (std::size_t i = entities.size(); i-- > 0;) {
+        Collider collider;
+        collider.width = 32.0f;
+        collider.height = 32.0f;
+        collider.enabled = i != 4;
+        coordinator.AddComponent(entities[i], collider);
+    }
+
+    std::vector<std::pair<ECS::Entity, ECS::Entity>> reported;
+    system->SetCollisionCallback([&](ECS::Entity a, ECS::Entity b) {
+        reported.emplace_back(a, b);
+    });
+    system->Update(0.0f);
+    const std::vector<std::pair<ECS::Entity, ECS::Entity>> all{
+        {entities[0], entities[1]}, {entities[0], entities[2]}, {entities[1], entities[2]}};
+    EXPECT_EQ(reported, all);
+    EXPECT_EQ(system->GetLastPairCount(), 3u);
+
+    // A callback destroying an entity suppresses its remaining pairs
+    reported.clear();
+    system->SetCollisionCallback([&](ECS::Entity a, ECS::Entity b) {
+        reported.emplace_back(a, b);
+        coordinator.DestroyEntity(a);
+    });
+    system->Update(0.0f);
+    const std::vector<std::pair<ECS::Entity, ECS::Entity>> first{{entities[0], entities[1]}, {entities[1], entities[2]}};
+    EXPECT_EQ(reported, first);
+}
+
+TEST(CollisionSystemTest, LayersFilterPairsInBroadPhase) {
+    auto coordinator = MakeCoordinator();
+    coordinator.RegisterComponent<Position>();
+    coordinator.RegisterComponent<Collider>();
+    auto system = coordinator.RegisterSystem<CollisionSystem>(&coordinator);
+    ECS::Signature sig;
+    sig.set(coordinator.GetComponentType<Position>());
+    sig.set(coordinator.GetComponentType<Collider>());
+    coordinator.SetSystemSignature<CollisionSystem>(sig);
+
+    eng::engine::physics::CollisionLayerTable layers;
+    layers.setCollides("player_projectile", "enemy");
+    EXPECT_TRUE(layers.collides("enemy", "player_projectile"));
+    EXPECT_FALSE(layers.collides("enemy", "enemy"));
+
+    // All boxes overlap: two bullets, two enemies
+    std::vector<ECS::Entity> entities;
+    for (const char* tag : {"player_projectile", "enemy", "player_projectile", "enemy"}) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, Position{0.0f, 0.0f});
+        Collider collider;
+        collider.width = 16.0f;
+        collider.height = 16.0f;
+        layers.assign(collider, tag);
+        coordinator.AddComponent(e, collider);
+        entities.push_back(e);
+    }
+
+    std::vector<std::pair<ECS::Entity, ECS::Entity>> reported;
+    system->SetCollisionCallback([&](ECS::Entity a, ECS::Entity b) { reported.emplace_back(a, b); });
+    system->Update(0.0f);
+
+    // Bullet-bullet and enemy-enemy pairs are never generated
+    const std::vector<std::pair<ECS::Entity, ECS::Entity>> expected{
+        {entities[0], entities[1]}, {entities[0], entities[3]},
+        {entities[1], entities[2]}, {entities[2], entities[3]}};
+    EXPECT_EQ(reported, expected);
+    EXPECT_EQ(system->GetLastTestCount(), 4u);
+}
+
+TEST(CollisionSystemTest, UntaggedCollidersHitEveryLayer) {
+    auto coordinator = MakeCoordinator();
+    coordinator.RegisterComponent<Position>();
+    coordinator.RegisterComponent<Collider>();
+    auto system = coordinator.RegisterSystem<CollisionSystem>(&coordinator);
+    ECS::Signature sig;
+    sig.set(coordinator.GetComponentType<Position>());
+    sig.set(coordinator.GetComponentType<Collider>());
+    coordinator.SetSystemSignature<CollisionSystem>(sig);
+
+    eng::engine::physics::CollisionLayerTable layers;
+    layers.setCollides("player", "enemy");
+    EXPECT_NE(layers.layer("player"), Collider{}.layer);
+    EXPECT_TRUE(layers.collides("default", "enemy"));
+    EXPECT_FALSE(layers.collides("player", "player"));
+
+    // All boxes overlap: one untagged collider, two players, one enemy
+    std::vector<ECS::Entity> entities;
+    for (const char* tag : {"", "player", "enemy", "player"}) {
+        ECS::Entity e = coordinator.CreateEntity();
+        coordinator.AddComponent(e, Position{0.0f, 0.0f});
+        Collider collider;
+        collider.width = 16.0f;
+        collider.height = 16.0f;
+        if (*tag) {
+            layers.assign(collider, tag);
+        }
+        coordinator.AddComponent(e, collider);
+        entities.push_back(e);
+    }
+
+    std::vector<std::pair<ECS::Entity, ECS::Entity>> reported;
+    system->SetCollisionCallback([&](ECS::Entity a, ECS::Entity b) { reported.emplace_back(std::min(a, b), std::max(a, b)); });
+    system->Update(0.0f);
+    std::sort(reported.begin(), reported.end());
+
+    // Only the player-player pair is filtered out
+    const std::vector<std::pair<ECS::Entity, ECS::Entity>> expected{
+        {entities[0], entities[1]}, {entities[0], entities[2]}, {entities[0], entities[3]},
+        {entities[1], entities[2]}, {entities[2], entities[3]}};
+    EXPECT_EQ(reported, expected);
+}
+
+TEST(SpatialHashTest, QueryVisitsEachOverlappingItemOnce) {
+    using eng::engine::physics::Aabb;
+
+    eng::engine::physics::SpatialHash grid(50.0f);
+    std::vector<Aabb> boxes;
+    for (int i = 0; i < 400; ++i) {
+        const float x = static_cast<float>((i * 37) % 900);
+        const float y = static_cast<float>((i * 53) % 700);
+        const float size = (i % 50 == 0) ? 600.0f : 20.0f + static_cast<float>(i % 90);
+        boxes.push_back({x, y, x + size, y + size});
+        grid.insert(boxes.back());
+    }
+    // Clamped to the border cells on both sides: 2^31 + 1 cells per axis
+    boxes.push_back({-1e12f, -1e12f, 1e12f, 1e12f});
+    grid.insert(boxes.back());
+    grid.build();
+
+    for (const Aabb& region : {Aabb{100.0f, 100.0f, 260.0f, 180.0f}, Aabb{-50.0f, -50.0f, 5.0f, 5.0f},
+                               Aabb{-1000.0f, -1000.0f, 5000.0f, 5000.0f}, Aabb{-1e12f, -1e12f, 1e12f, 1e12f}}) {
+        std::vector<std::uint32_t> expected;
+        for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+            if (eng::engine::physics::overlaps(region, boxes[i])) {
+                expected.push_back(i);
+            }
+        }
+
+        std::vector<std::uint32_t> found;
+        grid.query(region, [&found](std::uint32_t item) { found.push_back(item); });
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(AtlasPackerTest, PacksWithinThePageWithoutOverlap) {
+    using eng::engine::rendering::IntRect;
+
+    eng::engine::rendering::AtlasPacker packer(256, 256, 1);
+    std::vector<IntRect> placed;
+    for (int i = 0; i < 200; ++i) {
+        const auto width = static_cast<std::uint32_t>(8 + (i * 13) % 40);
+        const auto height = static_cast<std::uint32_t>(8 + (i * 7) % 24);
+        IntRect rect;
+        if (!packer.pack(width, height, rect)) {
+            continue;
+        }
+        EXPECT_EQ(rect.width, static_cast<int>(width));
+        EXPECT_EQ(rect.height, static_cast<int>(height));
+        EXPECT_GE(rect.left, 0);
+        EXPECT_GE(rect.top, 0);
+        EXPECT_LE(rect.left + rect.width, 256);
+        EXPECT_LE(rect.top + rect.height, 256);
+        // The padding pixel right of and below each rectangle stays free
+        for (const IntRect& other : placed) {
+            const bool apart = rect.left >= other.left + other.width + 1 || other.left >= rect.left + rect.width + 1 ||
+                               rect.top >= other.top + other.height + 1 || other.top >= rect.top + rect.height + 1;
+            EXPECT_TRUE(apart);
+        }
+        placed.push_back(rect);
+    }
+
+    EXPECT_GT(placed.size(), 50u);
+    EXPECT_GT(packer.getOccupancy(), 0.6f);
+    IntRect rect;
+    EXPECT_FALSE(packer.pack(300, 10, rect));
+
+    packer.reset();
+    EXPECT_TRUE(packer.pack(200, 200, rect));
+    EXPECT_EQ(rect.left, 0);
+    EXPECT_EQ(rect.top, 0);
+}
+
+TEST(RenderSystemTest, DrawsOneCallPerLayerAndTextureAndCullsOffScreen) {
+    using namespace eng::engine::rendering;
+
+    ECS::Coordinator coordinator;
+    coordinator.Init();
+    coordinator.RegisterComponent<Position>();
+    coordinator.RegisterComponent<Sprite>();
+    auto system = coordinator.RegisterSystem<RenderSystem>();
+    ECS::Signature signature;
+    signature.set(coordinator.GetComponentType<Position>());
+    signature.set(coordinator.GetComponentType<Sprite>());
+    coordinator.SetSystemSignature<RenderSystem>(signature);
+
+    null::NullRenderer renderer;
+    Camera camera;
+    camera.setViewport(IntRect(0, 0, 1920, 1080));
+    camera.setPosition(Vector2f(960.0f, 540.0f));
+    system->SetRenderer(&renderer);
+    system->SetCoordinator(&coordinator);
+    system->SetCamera(&camera);
+
+    null::NullTexture sheets[2] = {null::NullTexture(Vector2u(64, 64)), null::NullTexture(Vector2u(64, 64))};
+    std::vector<std::unique_ptr<null::NullSprite>> sprites;
+    std::vector<ECS::Entity> entities;
+    for (int i = 0; i < 30; ++i) {
+        sprites.push_back(std::make_unique<null::NullSprite>());
+        sprites.back()->setTexture(&sheets[i % 2]);
+        ECS::Entity entity = coordinator.CreateEntity();
+        // Every 10th entity has flown past the right edge
+        const float x = (i % 10 == 9) ? 1930.0f : static_cast<float>(i * 50);
+        coordinator.AddComponent(entity, Position{x, 100.0f});
+        Sprite sprite;
+        sprite.sprite = sprites.back().get();
+        sprite.textureRect = IntRect(0, 0, 16, 16);
+        sprite.layer = (i * 7) % 3;
+        coordinator.AddComponent(entity, sprite);
+        entities.push_back(entity);
+    }
+
+    renderer.clear();
+    system->Update(0.0f);
+    EXPECT_EQ(renderer.getSpriteCount(), 27u);
+    EXPECT_EQ(renderer.getDrawCallCount(), 6u);
+    EXPECT_EQ(rtype::core::Profiler::getInstance().getSpritesCulled(), 3u);
+    const auto& commands = renderer.getCommands();
+    for (std::size_t i = 1; i < commands.size(); ++i) {
+        EXPECT_LE(commands[i - 1].layer, commands[i].layer);
+        EXPECT_LE(commands[i - 1].drawCall, commands[i].drawCall);
+    }
+
+    // A layer change is picked up on the next frame; a despawn drops the sprite
+    coordinator.GetComponent<Sprite>(entities[0]).layer = 7;
+    coordinator.DestroyEntity(entities[1]);
+    renderer.clear();
+    system->Update(0.0f);
+    EXPECT_EQ(renderer.getSpriteCount(), 26u);
+    EXPECT_EQ(renderer.getDrawCallCount(), 7u);
+    EXPECT_EQ(renderer.getCommands().back().layer, 7);
+
+    // A texture swap and a spawn each move one sprite into an existing group
+    sprites[2]->setTexture(&sheets[1]);
+    ECS::Entity spawned = coordinator.CreateEntity();
+    coordinator.AddComponent(spawned, Position{10.0f, 10.0f});
+    Sprite late;
+    late.sprite = sprites[3].get();
+    late.textureRect = IntRect(0, 0, 16, 16);
+    late.layer = 7;
+    coordinator.AddComponent(spawned, late);
+    renderer.clear();
+    system->Update(0.0f);
+    EXPECT_EQ(renderer.getSpriteCount(), 27u);
+    EXPECT_EQ(renderer.getDrawCallCount(), 8u);
+    const auto& reordered = renderer.getCommands();
+    for (std::size_t i = 1; i < reordered.size(); ++i) {
+        EXPECT_LE(reordered[i - 1].layer, reordered[i].layer);
+        EXPECT_LE(reordered[i - 1].drawCall, reordered[i].drawCall);
+    }
+}
+
+TEST(RenderSystemTest, CullsAtlasSpritesByTheirRegion) {
+    using namespace eng::engine::rendering;
+
+    ECS::Coordinator coordinator;
+    coordinator.Init();
+    coordinator.RegisterComponent<Position>();
+    coordinator.RegisterComponent<Sprite>();
+    auto system = coordinator.RegisterSystem<RenderSystem>();
+    ECS::Signature signature;
+    signature.set(coordinator.GetComponentType<Position>());
+    signature.set(coordinator.GetComponentType<Sprite>());
+    coordinator.SetSystemSignature<RenderSystem>(signature);
+
+    null::NullRenderer renderer;
+    Camera camera;
+    camera.setViewport(IntRect(0, 0, 1920, 1080));
+    camera.setPosition(Vector2f(960.0f, 540.0f));
+    system->SetRenderer(&renderer);
+    system->SetCoordinator(&coordinator);
+    system->SetCamera(&camera);
+
+    // No textureRect on the components: the size must come from the 32x32 region, not the page
+    null::NullTexture page(Vector2u(2048, 2048));
+    null::NullSprite sprites[2];
+    for (int i = 0; i < 2; ++i) {
+        sprites[i].setTexture(&page);
+        sprites[i].setAtlasRegion(IntRect(512, 256, 32, 32));
+        ECS::Entity entity = coordinator.CreateEntity();
+        // One on screen, one past the left edge by more than its 96px width
+        coordinator.AddComponent(entity, Position{i == 0 ? 100.0f : -200.0f, 100.0f});
+        Sprite sprite;
+        sprite.sprite = &sprites[i];
+        coordinator.AddComponent(entity, sprite);
+    }
+
+    renderer.clear();
+    system->Update(0.0f);
+    EXPECT_EQ(renderer.getSpriteCount(), 1u);
+    EXPECT_EQ(rtype::core::Profiler::getInstance().getSpritesCulled(), 1u);
+}
+
+TEST(AnimationSystemTest, WritesFrameRectsAndHidesFinishedClips) {
+    using eng::engine::rendering::IntRect;
+
+    ECS::Coordinator coordinator;
+    coordinator.Init();
+    coordinator.RegisterComponent<Animation>();
+    coordinator.RegisterComponent<Sprite>();
+    auto system = coordinator.RegisterSystem<AnimationSystem>();
+    system->SetCoordinator(&coordinator);
+
+    eng::engine::rendering::null::NullSprite native;
+    Animation clip;
+    clip.frameTime = 0.1f;
+    clip.frameCount = 4;
+    clip.frameWidth = 32;
+    clip.frameHeight = 16;
+    clip.startX = 8;
+    clip.spacing = 2;
+
+    // Three in lockstep, one half a frame ahead, one that does not loop
+    std::vector<ECS::Entity> entities;
+    for (int i = 0; i < 5; ++i) {
+        ECS::Entity entity = coordinator.CreateEntity();
+        Animation animation = clip;
+        animation.currentTime = (i == 3) ? 0.05f : 0.0f;
+        animation.loop = (i != 4);
+        coordinator.AddComponent(entity, animation);
+        Sprite sprite;
+        sprite.sprite = &native;
+        coordinator.AddComponent(entity, sprite);
+        entities.push_back(entity);
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        system->Update(0.06f);
+    }
+    for (int i : {0, 1, 2}) {
+        EXPECT_EQ(coordinator.GetComponent<Animation>(entities[i]).currentFrame, 1);
+        const IntRect rect = coordinator.GetComponent<Sprite>(entities[i]).textureRect;
+        EXPECT_EQ(rect.left, 8 + 34);
+        EXPECT_EQ(rect.width, 32);
+        EXPECT_EQ(rect.height, 16);
+    }
+    EXPECT_EQ(coordinator.GetComponent<Animation>(entities[3]).currentFrame, 2);
+    // The native sprite is left alone: the renderer applies rects at batch time
+    EXPECT_EQ(native.getTextureRect().width, 0);
+
+    for (int frame = 0; frame < 20; ++frame) {
+        system->Update(0.06f);
+    }
+    EXPECT_TRUE(coordinator.GetComponent<Animation>(entities[4]).finished);
+    EXPECT_EQ(coordinator.GetComponent<Sprite>(entities[4]).scaleX, 0.0f);
+    EXPECT_FALSE(coordinator.GetComponent<Animation>(entities[0]).finished);
+    EXPECT_EQ(coordinator.GetComponent<Sprite>(entities[0]).scaleX, 3.0f);
+}
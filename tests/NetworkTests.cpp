@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
 #include "network/Serializer.hpp"
+#include "network/BitStream.hpp"
 #include "network/Compression.hpp"
 #include "network/RoomManager.hpp"
 #include "network/Prediction.hpp"
 #include "network/Packet.hpp"
+#include "network/SpscRing.hpp"
 #include "network/RTypeProtocol.hpp"
 #include <limits>
+#include <thread>
 
 
 
@@ -50,6 +53,57 @@ TEST(SerializerTest, StringBoundary) {
     EXPECT_THROW(deserializer.readString(), std::runtime_error);
 }
 
+TEST(BitStreamTest, MixedWidthsRoundTrip) {
+    Network::BitWriter writer;
+    writer.writeBits(5, 3);
+    writer.writeBool(true);
+    writer.writeBits(0xABCDEF12u, 32);
+    writer.writeSigned(-3, 4);
+    writer.writeVarint(300);
+    writer.writeVarint(7, 3);
+    writer.writeSignedVarint(-1, 6);
+    writer.writeSignedVarint(std::numeric_limits<int32_t>::min());
+    writer.writeQuantized(0.25f, -1.0f, 1.0f, 10);
+    EXPECT_EQ(writer.getBuffer().size(), (writer.getBitCount() + 7) / 8);
+
+    Network::BitReader reader(writer.getBuffer());
+    EXPECT_EQ(reader.readBits(3), 5u);
+    EXPECT_TRUE(reader.readBool());
+    EXPECT_EQ(reader.readBits(32), 0xABCDEF12u);
+    EXPECT_EQ(reader.readSigned(4), -3);
+    EXPECT_EQ(reader.readVarint(), 300u);
+    EXPECT_EQ(reader.readVarint(3), 7u);
+    EXPECT_EQ(reader.readSignedVarint(6), -1);
+    EXPECT_EQ(reader.readSignedVarint(), std::numeric_limits<int32_t>::min());
+    EXPECT_NEAR(reader.readQuantized(-1.0f, 1.0f, 10), 0.25f, 1.0f / 1023.0f);
+    EXPECT_LT(reader.getBitsRemaining(), 8u);
+}
+
+TEST(BitStreamTest, SmallValuesStaySmall) {
+    Network::BitWriter writer;
+    writer.writeVarint(3, 3);        // one group: 4 bits
+    writer.writeSignedVarint(-2, 3); // zig-zag 3: 4 bits
+    EXPECT_EQ(writer.getBitCount(), 8u);
+}
+
+TEST(BitStreamTest, BoundsChecks) {
+    Network::BitWriter writer;
+    EXPECT_THROW(writer.writeBits(8, 3), std::runtime_error);
+    EXPECT_THROW(writer.writeSigned(8, 4), std::runtime_error);
+    EXPECT_THROW(writer.writeQuantized(0.0f, 1.0f, 1.0f, 8), std::runtime_error);
+
+    // Out of range floats clamp instead of throwing
+    writer.writeQuantized(5.0f, 0.0f, 1.0f, 4);
+    Network::BitReader clamped(writer.getBuffer());
+    EXPECT_FLOAT_EQ(clamped.readQuantized(0.0f, 1.0f, 4), 1.0f);
+    EXPECT_THROW(clamped.readBits(5), std::runtime_error);
+
+    // A varint whose continuation bits never end
+    std::vector<char> endless(8, static_cast<char>(0xFF));
+    Network::BitReader reader(endless);
+    EXPECT_THROW(reader.readVarint(), std::runtime_error);
+}
+
 
 
 TEST(CompressionTest, RLE_Efficiency) {
@@ -91,6 +145,236 @@ TEST(CompressionTest, RLE_Empty) {
     EXPECT_TRUE(decompressed.empty());
 }
 
+TEST(CompressionTest, LZ_RoundTrip) {
+    std::vector<char> data;
+    for (int i = 0; i < 2000; ++i) {
+        // Repeated records with a changing field, plus an overlapping run
+        const std::string record = "monster#" + std::to_string(i % 17) + ";hp=3;";
+        data.insert(data.end(), record.begin(), record.end());
+    }
+    data.insert(data.end(), 300, 'Z');
+
+    auto compressed = Network::LzCompression::compress(data);
+    EXPECT_LT(compressed.size(), data.size() / 4);
+    EXPECT_EQ(Network::LzCompression::decompress(compressed, data.size()), data);
+
+    std::vector<char> empty;
+    EXPECT_TRUE(Network::LzCompression::decompress(Network::LzCompression::compress(empty)).empty());
+}
+
+TEST(CompressionTest, LZ_IncompressibleAndCorrupt) {
+    std::vector<char> noise(1000);
+    uint32_t state = 12345;
+    for (auto& byte : noise) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<char>(state >> 24);
+    }
+    auto compressed = Network::LzCompression::compress(noise);
+    EXPECT_LE(compressed.size(), noise.size() + noise.size() / 255 + 16);
+    EXPECT_EQ(Network::LzCompression::decompress(compressed), noise);
+
+    // Larger than the caller allows, truncated, or a match before the start
+    EXPECT_THROW(Network::LzCompression::decompress(compressed, 999), std::runtime_error);
+    compressed.resize(compressed.size() / 2);
+    EXPECT_THROW(Network::LzCompression::decompress(compressed), std::runtime_error);
+    std::vector<char> badOffset = {8, 0x0F, 0x05, 0x00};
+    EXPECT_THROW(Network::LzCompression::decompress(badOffset), std::runtime_error);
+}
+
+TEST(CompressionTest, PacketCompressedOnlyWhenSmaller) {
+    NetworkPacket packet(42);
+    packet.header.seq = 7;
+    packet.payload.assign(500, 'A');
+
+    auto wire = packet.serializeCompressed();
+    EXPECT_LT(wire.size(), packet.serialize().size());
+    EXPECT_TRUE(PacketHeader::deserialize(wire.data()).flags & PacketHeader::FLAG_COMPRESSED);
+
+    NetworkPacket result = NetworkPacket::deserialize(wire.data(), wire.size());
+    EXPECT_EQ(result.header.type, 42);
+    EXPECT_EQ(result.header.seq, 7u);
+    EXPECT_EQ(result.header.flags, 0);
+    EXPECT_EQ(result.payload, packet.payload);
+
+    // Short payloads go out untouched
+    packet.payload.assign(10, 'A');
+    EXPECT_EQ(packet.serializeCompressed(), packet.serialize());
+}
+
+TEST(PacketBufferTest, PoolRecyclesSharedBuffers) {
+    Network::PacketBufferPool pool(2, 128);
+    Network::PacketRef first = pool.acquire();
+    Network::PacketRef second = pool.acquire();
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_FALSE(pool.acquire()); // Exhausted
+    EXPECT_THROW(first->setSize(129), std::runtime_error);
+
+    // A copy keeps the buffer out of the pool until the last one goes
+    Network::PacketBuffer* raw = first.get();
+    Network::PacketRef copy = first;
+    first.reset();
+    EXPECT_EQ(pool.inUse(), 2u);
+    copy.reset();
+    EXPECT_EQ(pool.inUse(), 1u);
+
+    Network::PacketRef again = pool.acquire();
+    EXPECT_EQ(again.get(), raw);
+    EXPECT_EQ(again->size(), 0u);
+}
+
+TEST(PacketBufferTest, PacketViewReadsInPlace) {
+    Network::PacketBufferPool pool(4);
+    auto receive = [&pool](const std::vector<char>& datagram) {
+        Network::PacketRef buffer = pool.acquire();
+        std::memcpy(buffer->data(), datagram.data(), datagram.size());
+        buffer->setSize(datagram.size());
+        return PacketView::parse(std::move(buffer), pool);
+    };
+
+    NetworkPacket packet(42);
+    packet.header.seq = 9;
+    packet.payload = {'a', 'b', 'c'};
+    PacketView view = receive(packet.serialize());
+    EXPECT_EQ(view.header.type, 42);
+    EXPECT_EQ(view.header.seq, 9u);
+    ASSERT_EQ(view.payload.size(), 3u);
+    EXPECT_EQ(view.payload.data(), view.bytes().data() + sizeof(PacketHeader)); // No copy
+    EXPECT_EQ(view.toPacket().payload, packet.payload);
+
+    // Compressed payloads are inflated into a second buffer, the first is recycled
+    packet.payload.assign(400, 'x');
+    PacketView inflated = receive(packet.serializeCompressed());
+    EXPECT_EQ(inflated.header.flags, 0);
+    EXPECT_EQ(std::vector<char>(inflated.payload.begin(), inflated.payload.end()), packet.payload);
+    EXPECT_EQ(pool.inUse(), 2u);
+
+    NetworkPacket rebuilt = NetworkPacket::deserialize(inflated.bytes().data(), inflated.bytes().size());
+    EXPECT_EQ(rebuilt.payload, packet.payload);
+
+    // Payload parsers read the span without copying it
+    JoinRoomPayload join;
+    join.roomId = 77;
+    packet.payload = join.serialize();
+    EXPECT_EQ(JoinRoomPayload::deserialize(receive(packet.serialize()).payload).roomId, 77u);
+}
+
+TEST(PacketBufferTest, MtuDatagramInflatesIntoLargePool) {
+    Network::PacketBufferPool small(2, Network::PacketBufferPool::MTU_BUFFER_SIZE);
+    Network::PacketBufferPool large(1);
+
+    NetworkPacket packet(5);
+    packet.payload.assign(4000, 'y');
+    const std::vector<char> datagram = packet.serializeCompressed();
+    ASSERT_LT(datagram.size(), small.bufferSize());
+
+    Network::PacketRef buffer = small.acquire();
+    std::memcpy(buffer->data(), datagram.data(), datagram.size());
+    buffer->setSize(datagram.size());
+    PacketView view = PacketView::parse(std::move(buffer), large);
+    EXPECT_EQ(view.payload.size(), 4000u);
+    EXPECT_EQ(small.inUse(), 0u); // The compressed datagram went back
+    EXPECT_EQ(large.inUse(), 1u);
+}
+
+TEST(SpscRingTest, BoundedBatchesAndDrops) {
+    Network::SpscRing<int> ring(3); // Rounded up to 4
+    EXPECT_EQ(ring.capacity(), 4u);
+
+    for (int round = 0; round < 3; ++round) { // Wraps around the slots
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.tryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(ring.tryPush(99));
+        EXPECT_EQ(ring.size(), 4u);
+
+        int first = -1;
+        EXPECT_TRUE(ring.tryPop(first));
+        EXPECT_EQ(first, round * 10);
+
+        std::vector<int> batch;
+        EXPECT_EQ(ring.popBatch(batch), 3u);
+        EXPECT_EQ(batch, (std::vector<int>{round * 10 + 1, round * 10 + 2, round * 10 + 3}));
+        EXPECT_FALSE(ring.tryPop(first));
+    }
+
+    Network::QueueStats stats = ring.stats();
+    EXPECT_EQ(stats.depth, 0u);
+    EXPECT_EQ(stats.capacity, 4u);
+    EXPECT_EQ(stats.dropped, 3u);
+}
+
+TEST(SpscRingTest, CrossThreadOrder) {
+    Network::SpscRing<uint32_t> ring(64);
+    constexpr uint32_t COUNT = 200000;
+
+    // Wait for room instead of retrying tryPush, so every push counted as a drop is a real loss
+    std::thread producer([&ring] {
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            while (ring.size() == ring.capacity()) {
+                std::this_thread::yield();
+            }
+            ring.tryPush(uint32_t(i));
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+        const size_t consumed = ring.consume([&](uint32_t&& value) {
+            ordered = ordered && value == expected;
+            ++expected;
+        });
+        if (consumed == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(ring.size(), 0u);
+    EXPECT_EQ(ring.stats().dropped, 0u);
+}
+
+TEST(SpscRingTest, DrainSignalNeverStrandsLastPush) {
+    Network::SpscRing<uint32_t> ring(1024);
+    Network::DrainSignal signal;
+    constexpr uint32_t COUNT = 200000;
+    std::atomic<int> posted{0};       // Drains posted and not yet run, like asio::post
+    std::atomic<bool> producing{true};
+    uint32_t lastPushed = 0;
+    uint32_t lastReceived = 0;
+
+    // Same protocol as UdpServer::sendTo/flushOutbound
+    std::thread consumer([&] {
+        while (true) {
+            if (posted.load() > 0) {
+                posted.fetch_sub(1);
+                signal.begin();
+                ring.consume([&](uint32_t&& value) { lastReceived = value; });
+            } else if (!producing.load()) {
+                if (posted.load() == 0) {
+                    break;
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint32_t i = 1; i <= COUNT; ++i) {
+        if (ring.tryPush(uint32_t(i))) {
+            lastPushed = i;
+            if (signal.request()) {
+                posted.fetch_add(1);
+            }
+        }
+    }
+    producing.store(false);
+    consumer.join();
+    EXPECT_EQ(lastReceived, lastPushed);
+    EXPECT_EQ(ring.size(), 0u);
+}
+
 
 
 TEST(RoomManagerTest, CreateAndJoin) {
@@ -230,6 +514,132 @@ TEST(ProtocolTest, WorldSnapshotWithAcks) {
     EXPECT_EQ(data.entities[1].type, EntityType::ENTITY_MONSTER);
 }
 
+TEST(ProtocolTest, WorldSnapshotDeltaAgainstBaseline) {
+    std::vector<EntityState> baseline(3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        baseline[i].id = i + 1;
+        baseline[i].type = EntityType::ENTITY_MONSTER;
+        baseline[i].x = static_cast<int16_t>(100 * (i + 1));
+        baseline[i].y = 50;
+        baseline[i].hp = 3;
+    }
+    SnapshotHistory history;
+    history.store(10, baseline);
+
+    // 1 moves, 2 is unchanged, 3 is gone and 4 appears
+    std::vector<EntityState> current = {baseline[0], baseline[1]};
+    current[0].x = 110;
+    EntityState created;
+    created.id = 4;
+    created.type = EntityType::ENTITY_POWERUP;
+    created.x = 400;
+    current.push_back(created);
+
+    SnapshotHeader header;
+    header.snapshotSeq = 11;
+    header.baselineSeq = 10;
+    auto packet = RTypeProtocol::createWorldSnapshotPacket(header, {}, current, history.find(10));
+    auto full = RTypeProtocol::createWorldSnapshotPacket(header, {}, current);
+    EXPECT_LT(packet.payload.size(), full.payload.size());
+
+    auto data = RTypeProtocol::getWorldSnapshot(packet, &history);
+    EXPECT_EQ(data.header.baselineSeq, 10);
+    EXPECT_EQ(data.header.entityCount, 2); // 1 changed, 4 created
+    ASSERT_EQ(data.removedIds.size(), 1);
+    EXPECT_EQ(data.removedIds[0], 3);
+
+    ASSERT_EQ(data.entities.size(), 3);
+    EXPECT_EQ(data.entities[0].id, 1);
+    EXPECT_EQ(data.entities[0].x, 110);
+    EXPECT_EQ(data.entities[0].hp, 3);
+    EXPECT_EQ(data.entities[1].id, 2);
+    EXPECT_EQ(data.entities[1].x, 200);
+    EXPECT_EQ(data.entities[2].id, 4);
+    EXPECT_EQ(data.entities[2].type, EntityType::ENTITY_POWERUP);
+    EXPECT_EQ(data.entities[2].x, 400);
+
+    // Without its baseline a delta cannot be rebuilt
+    SnapshotHistory empty;
+    EXPECT_THROW(RTypeProtocol::getWorldSnapshot(packet, &empty), std::runtime_error);
+}
+
+TEST(ProtocolTest, SnapshotHistoryForgetsOldBaselines) {
+    SnapshotHistory history;
+    std::vector<EntityState> entities(1);
+    for (uint32_t seq = 1; seq <= 40; ++seq) {
+        entities[0].id = seq;
+        history.store(seq, entities);
+    }
+    EXPECT_EQ(history.find(8), nullptr);
+    ASSERT_NE(history.find(40), nullptr);
+    EXPECT_EQ((*history.find(40))[0].id, 40);
+    EXPECT_EQ(history.find(0), nullptr);
+}
+
+TEST(ProtocolTest, BitPackedEntityState) {
+    EntityState original;
+    original.id = 123456;
+    original.type = EntityType::ENTITY_MONSTER;
+    original.x = -40;
+    original.y = 1079;
+    original.vx = -350;
+    original.hp = 2000;
+    original.chargeLevel = 99;
+    original.enemyType = 3;
+    original.projectileType = 4;
+    original.score = 98765;
+
+    Network::BitWriter writer;
+    original.pack(writer);
+    EXPECT_LT(writer.getBuffer().size(), sizeof(EntityState));
+
+    Network::BitReader reader(writer.getBuffer());
+    EntityState result = EntityState::unpack(reader);
+    EXPECT_EQ(result.diff(original), 0);
+    EXPECT_EQ(result.id, original.id);
+}
+
+TEST(ProtocolTest, BitPackedClientInputAndHeader) {
+    ClientInput input;
+    input.playerId = 200;
+    input.inputMask = 0x1F; // every button held
+    input.chargeLevel = 5;
+    input.inputSeq = 70000;
+    input.lastSnapshotSeq = 4242;
+
+    SnapshotHeader header;
+    header.entityCount = 150;
+    header.snapshotSeq = 5000;
+    header.playerAckCount = 4;
+    header.baselineSeq = 4997;
+    header.removedCount = 12;
+
+    Network::BitWriter writer;
+    input.pack(writer);
+    header.pack(writer);
+    EXPECT_LT(writer.getBuffer().size(), sizeof(ClientInput) + sizeof(SnapshotHeader));
+
+    Network::BitReader reader(writer.getBuffer());
+    ClientInput inputResult = ClientInput::unpack(reader);
+    EXPECT_EQ(inputResult.playerId, 200);
+    EXPECT_EQ(inputResult.inputMask, 0x1F);
+    EXPECT_EQ(inputResult.chargeLevel, 5);
+    EXPECT_EQ(inputResult.inputSeq, 70000u);
+    EXPECT_EQ(inputResult.lastSnapshotSeq, 4242u);
+
+    SnapshotHeader headerResult = SnapshotHeader::unpack(reader);
+    EXPECT_EQ(headerResult.entityCount, 150u);
+    EXPECT_EQ(headerResult.snapshotSeq, 5000u);
+    EXPECT_EQ(headerResult.playerAckCount, 4);
+    EXPECT_EQ(headerResult.baselineSeq, 4997u);
+    EXPECT_EQ(headerResult.removedCount, 12);
+
+    // Input masks only have 5 bits on the wire
+    input.inputMask = 0x20;
+    Network::BitWriter overflow;
+    EXPECT_THROW(input.pack(overflow), std::runtime_error);
+}
+
 TEST(ProtocolTest, QuantizationLimits) {
     EntityState e;
     e.x = 32767;
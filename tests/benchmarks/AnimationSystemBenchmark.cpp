@@ -0,0 +1,137 @@
+// ============================================
+// AnimationSystemBenchmark.cpp
+// ============================================
+// CPU cost of AnimationSystem::Update on the headless NullRenderer, alone
+// and followed by RenderSystem::Update, which applies the new frame rects
+// while batching. "waves" spawns enemies in groups of 8 on one clip
+// phase, as levels do, so their frames change together; "staggered" gives
+// every animation its own phase.
+// UISystem is not covered: it draws straight to an SFMLWindow and does
+// nothing without one, so it cannot run on the null backend.
+// ============================================
+
+#include "components/Animation.hpp"
+#include "components/Position.hpp"
+#include "components/Sprite.hpp"
+#include "ecs/Coordinator.hpp"
+#include "rendering/Camera.hpp"
+#include "rendering/null/NullRenderer.hpp"
+#include "rendering/null/NullTexture.hpp"
+#include "systems/AnimationSystem.hpp"
+#include "systems/RenderSystem.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+
+    using namespace eng::engine::rendering;
+
+    struct Result {
+        double animUsPerFrame = 0.0;
+        double totalUsPerFrame = 0.0;
+        std::size_t drawCalls = 0;
+    };
+
+    Result Run(std::size_t count, bool staggered, int frames)
+    {
+        ECS::Coordinator coordinator;
+        coordinator.Init();
+        coordinator.RegisterComponent<Position>();
+        coordinator.RegisterComponent<Sprite>();
+        coordinator.RegisterComponent<Animation>();
+
+        auto animation = coordinator.RegisterSystem<AnimationSystem>();
+        ECS::Signature animated;
+        animated.set(coordinator.GetComponentType<Animation>());
+        animated.set(coordinator.GetComponentType<Sprite>());
+        coordinator.SetSystemSignature<AnimationSystem>(animated);
+        animation->SetCoordinator(&coordinator);
+
+        auto render = coordinator.RegisterSystem<RenderSystem>();
+        ECS::Signature drawn;
+        drawn.set(coordinator.GetComponentType<Position>());
+        drawn.set(coordinator.GetComponentType<Sprite>());
+        coordinator.SetSystemSignature<RenderSystem>(drawn);
+
+        null::NullRenderer renderer;
+        Camera camera;
+        camera.setViewport(IntRect(0, 0, 1920, 1080));
+        camera.setPosition(Vector2f(960.0f, 540.0f));
+        render->SetRenderer(&renderer);
+        render->SetCoordinator(&coordinator);
+        render->SetCamera(&camera);
+
+        // One sheet per enemy kind, 8 frames of 32x32 in a row
+        std::vector<null::NullTexture> sheets(4, null::NullTexture(Vector2u(256, 32)));
+        std::vector<std::unique_ptr<null::NullSprite>> sprites;
+        for (std::size_t i = 0; i < sheets.size(); ++i) {
+            sprites.push_back(std::make_unique<null::NullSprite>());
+            sprites.back()->setTexture(&sheets[i]);
+        }
+
+        std::uint32_t seed = 11;
+        auto next = [&seed](float range) {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * range;
+        };
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ECS::Entity entity = coordinator.CreateEntity();
+            coordinator.AddComponent(entity, Position{next(1920.0f), next(1080.0f)});
+
+            const std::size_t kind = (i / 8) % sheets.size();
+            Sprite sprite;
+            sprite.sprite = sprites[kind].get();
+            sprite.textureRect = IntRect(0, 0, 32, 32);
+            sprite.layer = static_cast<int>(kind);
+            coordinator.AddComponent(entity, sprite);
+
+            Animation clip;
+            clip.frameTime = 0.1f;
+            clip.frameCount = 8;
+            clip.frameWidth = 32;
+            clip.frameHeight = 32;
+            clip.currentTime = staggered ? next(0.1f) : 0.0f;
+            clip.currentFrame = staggered ? static_cast<int>(next(8.0f)) % 8 : 0;
+            coordinator.AddComponent(entity, clip);
+        }
+
+        Result result;
+        double animUs = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            auto animStart = std::chrono::steady_clock::now();
+            animation->Update(1.0f / 60.0f);
+            animUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - animStart).count();
+
+            renderer.clear();
+            render->Update(0.0f);
+            renderer.display();
+        }
+        auto end = std::chrono::steady_clock::now();
+        result.animUsPerFrame = animUs / frames;
+        result.totalUsPerFrame = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+        result.drawCalls = renderer.getDrawCallCount();
+        return result;
+    }
+
+} // namespace
+
+int main()
+{
+    const std::size_t entityCounts[] = {500, 2000, 8000};
+
+    std::printf("%-10s %-10s %13s %15s %11s\n", "entities", "phases", "anim us/frm", "+render us/frm", "draw calls");
+    for (std::size_t count : entityCounts) {
+        const int frames = static_cast<int>(200000 / count + 10);
+        for (bool staggered : {false, true}) {
+            const Result result = Run(count, staggered, frames);
+            std::printf("%-10zu %-10s %13.1f %15.1f %11zu\n", count, staggered ? "staggered" : "waves",
+                result.animUsPerFrame, result.totalUsPerFrame, result.drawCalls);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+// ============================================
+// CollisionBroadPhaseBenchmark.cpp
+// ============================================
+// Compares the former all-pairs collision scan against the
+// SpatialHash broad phase used by CollisionSystem, on a screen-sized
+// scene of ship/bullet-sized boxes. Reports box tests, overlapping
+// pairs (must match) and time per frame for growing entity counts,
+// then the same grid with collision layers (player shots, enemies,
+// enemy shots) dropping same-faction pairs before any box test.
+// ============================================
+
+#include "physics/CollisionLayers.hpp"
+#include "physics/SpatialHash.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    using eng::engine::physics::Aabb;
+
+    // Deterministic scene: 1920x1080 playfield, boxes between 8 and 72 units
+    std::vector<Aabb> MakeScene(std::size_t count)
+    {
+        std::vector<Aabb> boxes;
+        boxes.reserve(count);
+        std::uint32_t seed = 2024;
+        auto next = [&seed](float range) {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * range;
+        };
+        for (std::size_t i = 0; i < count; ++i) {
+            const float x = next(1920.0f);
+            const float y = next(1080.0f);
+            const float w = 8.0f + next(64.0f);
+            const float h = 8.0f + next(64.0f);
+            boxes.push_back({x, y, x + w, y + h});
+        }
+        return boxes;
+    }
+
+    struct Result {
+        std::size_t tests = 0;
+        std::size_t pairs = 0;
+        double microseconds = 0.0;
+    };
+
+    Result RunBruteForce(const std::vector<Aabb>& boxes, int frames)
+    {
+        Result result;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            result.tests = 0;
+            result.pairs = 0;
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                for (std::size_t j = i + 1; j < boxes.size(); ++j) {
+                    ++result.tests;
+                    if (eng::engine::physics::overlaps(boxes[i], boxes[j])) {
+                        ++result.pairs;
+                    }
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        result.microseconds = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+        return result;
+    }
+
+    struct LayerFilter {
+        std::uint32_t layer = ~0u;
+        std::uint32_t mask = ~0u;
+    };
+
+    // Factions of a typical wave: 40% player shots, 30% enemies, 30% enemy shots
+    std::vector<LayerFilter> MakeFactions(std::size_t count)
+    {
+        eng::engine::physics::CollisionLayerTable table;
+        table.setCollides("player", "enemy");
+        table.setCollides("player", "enemy_projectile");
+        table.setCollides("player_projectile", "enemy");
+
+        std::vector<LayerFilter> filters;
+        filters.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const char* tag = (i == 0) ? "player"
+                : (i % 10 < 4) ? "player_projectile"
+                : (i % 10 < 7) ? "enemy" : "enemy_projectile";
+            Collider collider;
+            table.assign(collider, tag);
+            filters.push_back({collider.layer, collider.mask});
+        }
+        return filters;
+    }
+
+    // Full per-frame cost: clear, insert every box, build, enumerate pairs
+    Result RunSpatialHash(const std::vector<Aabb>& boxes, const std::vector<LayerFilter>& filters, int frames)
+    {
+        eng::engine::physics::SpatialHash grid(128.0f);
+        Result result;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            grid.clear();
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                grid.insert(boxes[i], filters[i].layer, filters[i].mask);
+            }
+            grid.build();
+            result.pairs = 0;
+            result.tests = grid.forEachPair([&result](std::uint32_t, std::uint32_t) { ++result.pairs; });
+        }
+        auto end = std::chrono::steady_clock::now();
+        result.microseconds = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+        return result;
+    }
+
+} // namespace
+
+int main()
+{
+    const std::size_t entityCounts[] = {100, 400, 1000, 2000, 5000};
+    const int frames = 50;
+
+    std::printf("%-10s %8s %14s %12s %14s %12s %9s\n",
+        "entities", "pairs", "all-pairs tests", "all-pairs us", "grid tests", "grid us", "speedup");
+    for (std::size_t count : entityCounts) {
+        const std::vector<Aabb> boxes = MakeScene(count);
+        const Result brute = RunBruteForce(boxes, frames);
+        const Result grid = RunSpatialHash(boxes, std::vector<LayerFilter>(count), frames);
+
+        std::printf("%-10zu %8zu %14zu %12.1f %14zu %12.1f %8.1fx%s\n",
+            count, grid.pairs, brute.tests, brute.microseconds, grid.tests, grid.microseconds,
+            brute.microseconds / grid.microseconds, brute.pairs == grid.pairs ? "" : "  MISMATCH");
+    }
+
+    std::printf("\nwith collision layers\n");
+    std::printf("%-10s %12s %12s %14s %12s\n", "entities", "grid pairs", "layer pairs", "layer tests", "layer us");
+    for (std::size_t count : entityCounts) {
+        const std::vector<Aabb> boxes = MakeScene(count);
+        const Result grid = RunSpatialHash(boxes, std::vector<LayerFilter>(count), frames);
+        const Result layered = RunSpatialHash(boxes, MakeFactions(count), frames);
+
+        std::printf("%-10zu %12zu %12zu %14zu %12.1f\n",
+            count, grid.pairs, layered.pairs, layered.tests, layered.microseconds);
+    }
+    return 0;
+}